@@ -0,0 +1,288 @@
+#ifndef VECTORIZED_SEARCH_H
+#define VECTORIZED_SEARCH_H
+
+/*
+Descrição:
+Busca de valores em blocos contíguos (usada pela lista desenrolada).
+Para int, float e double a comparação é feita em vários elementos por
+instrução (SSE2: 4 int/float ou 2 double; AVX2: 8 int/float ou 4
+double). O conjunto de instruções é escolhido em tempo de execução,
+uma única vez, conforme o processador; nos demais tipos, compiladores
+ou arquiteturas é usada a busca escalar com operator==.
+A semântica é a de operator==: NaN nunca é encontrado e 0.0 == -0.0.
+*/
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define LISTA_SIMD_X86 1
+#endif
+
+/*---------------------------------------------------------------
+ * Enumeração SimdLevel
+ * Descrição: Conjuntos de instruções usados pela busca vetorial.
+ *---------------------------------------------------------------*/
+enum SimdLevel {
+    SimdScalar = 0,
+    SimdSse2 = 1,
+    SimdAvx2 = 2
+};
+
+// Melhor nível suportado pelo processador em que o programa roda.
+inline SimdLevel detectSimdLevel() {
+#ifdef LISTA_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return SimdAvx2;
+    if (__builtin_cpu_supports("sse2"))
+        return SimdSse2;
+#endif
+    return SimdScalar;
+}
+
+inline SimdLevel& activeSimdLevel() {
+    static SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+/*---------------------------------------------------------------
+ * Função simdLevel()
+ * Descrição: Nível usado pela busca vetorial (detectado na primeira
+ *            chamada).
+ *---------------------------------------------------------------*/
+inline SimdLevel simdLevel() {
+    return activeSimdLevel();
+}
+
+/*---------------------------------------------------------------
+ * Função setSimdLevel()
+ * Descrição: Limita a busca vetorial a 'requested' (por exemplo, para
+ *            comparar com a busca escalar em benchmarks). Nunca
+ *            ultrapassa o nível suportado. Não é thread-safe: deve ser
+ *            chamada antes de as listas serem usadas por outras threads.
+ * Retorno:
+ *    - nível efetivamente em uso.
+ *---------------------------------------------------------------*/
+inline SimdLevel setSimdLevel(SimdLevel requested) {
+    SimdLevel supported = detectSimdLevel();
+    activeSimdLevel() = (requested < supported) ? requested : supported;
+    return activeSimdLevel();
+}
+
+inline const char* simdLevelName(SimdLevel level) {
+    static const char* const names[] = {"escalar", "sse2", "avx2"};
+    return names[level];
+}
+
+/*---------------------------------------------------------------
+ * Template da estrutura ScalarSearch
+ * Descrição: Busca escalar em data[0, n), com operator==.
+ *    - find: posição da primeira ocorrência de value (ou -1).
+ *    - count: quantidade de ocorrências de value.
+ *---------------------------------------------------------------*/
+template <typename T>
+struct ScalarSearch {
+    static const bool vectorized = false;
+
+    static int find(const T* data, int n, const T& value) {
+        for (int i = 0; i < n; i++) {
+            if (data[i] == value)
+                return i;
+        }
+        return -1;
+    }
+
+    static int count(const T* data, int n, const T& value) {
+        int total = 0;
+        for (int i = 0; i < n; i++) {
+            if (data[i] == value)
+                total++;
+        }
+        return total;
+    }
+};
+
+/*---------------------------------------------------------------
+ * Template da estrutura ValueSearch
+ * Descrição: Busca usada pela lista para o tipo T: escalar por padrão,
+ *            com especializações vetoriais para int, float e double.
+ *---------------------------------------------------------------*/
+template <typename T>
+struct ValueSearch : ScalarSearch<T> {};
+
+#ifdef LISTA_SIMD_X86
+
+/*---------------------------------------------------------------
+ * Operações vetoriais por tipo e conjunto de instruções.
+ * Cada estrutura oferece:
+ *    - Lanes: elementos comparados por instrução.
+ *    - splat(value): vetor com value em todas as posições.
+ *    - equalMask(data, needle): um bit por posição igual a needle.
+ *    - bitCount(mask): quantidade de bits ligados em uma máscara.
+ *---------------------------------------------------------------*/
+#define LISTA_SSE2 __attribute__((target("sse2")))
+#define LISTA_AVX2 __attribute__((target("avx2,popcnt")))
+
+// Sem POPCNT garantido: tabela para máscaras de até 4 bits
+struct Sse2BitCount {
+    static int bitCount(int mask) {
+        static const unsigned char bits[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+        return bits[mask];
+    }
+};
+
+// Todo processador com AVX2 tem POPCNT
+struct Avx2BitCount {
+    LISTA_AVX2 static int bitCount(int mask) {
+        return __builtin_popcount(static_cast<unsigned>(mask));
+    }
+};
+
+struct Sse2IntOps : Sse2BitCount {
+    typedef int Scalar;
+    typedef __m128i Vector;
+    static const int Lanes = 4;
+    LISTA_SSE2 static Vector splat(int value) { return _mm_set1_epi32(value); }
+    LISTA_SSE2 static int equalMask(const int* data, Vector needle) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle)));
+    }
+};
+
+struct Sse2FloatOps : Sse2BitCount {
+    typedef float Scalar;
+    typedef __m128 Vector;
+    static const int Lanes = 4;
+    LISTA_SSE2 static Vector splat(float value) { return _mm_set1_ps(value); }
+    LISTA_SSE2 static int equalMask(const float* data, Vector needle) {
+        return _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data), needle));
+    }
+};
+
+struct Sse2DoubleOps : Sse2BitCount {
+    typedef double Scalar;
+    typedef __m128d Vector;
+    static const int Lanes = 2;
+    LISTA_SSE2 static Vector splat(double value) { return _mm_set1_pd(value); }
+    LISTA_SSE2 static int equalMask(const double* data, Vector needle) {
+        return _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data), needle));
+    }
+};
+
+struct Avx2IntOps : Avx2BitCount {
+    typedef int Scalar;
+    typedef __m256i Vector;
+    static const int Lanes = 8;
+    LISTA_AVX2 static Vector splat(int value) { return _mm256_set1_epi32(value); }
+    LISTA_AVX2 static int equalMask(const int* data, Vector needle) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, needle)));
+    }
+};
+
+struct Avx2FloatOps : Avx2BitCount {
+    typedef float Scalar;
+    typedef __m256 Vector;
+    static const int Lanes = 8;
+    LISTA_AVX2 static Vector splat(float value) { return _mm256_set1_ps(value); }
+    LISTA_AVX2 static int equalMask(const float* data, Vector needle) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data), needle, _CMP_EQ_OQ));
+    }
+};
+
+struct Avx2DoubleOps : Avx2BitCount {
+    typedef double Scalar;
+    typedef __m256d Vector;
+    static const int Lanes = 4;
+    LISTA_AVX2 static Vector splat(double value) { return _mm256_set1_pd(value); }
+    LISTA_AVX2 static int equalMask(const double* data, Vector needle) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data), needle, _CMP_EQ_OQ));
+    }
+};
+
+// Laços vetoriais: blocos de Ops::Lanes elementos e o restante escalar.
+// Um par por conjunto de instruções, para que o compilador gere cada um
+// com as instruções correspondentes.
+#define LISTA_SIMD_KERNELS(Suffix, Target)                                                  \
+    template <typename Ops>                                                                 \
+    Target int simdFind##Suffix(const typename Ops::Scalar* data, int n,                   \
+                                typename Ops::Scalar value) {                               \
+        typename Ops::Vector needle = Ops::splat(value);                                    \
+        int i = 0;                                                                          \
+        for (; i + Ops::Lanes <= n; i += Ops::Lanes) {                                      \
+            int mask = Ops::equalMask(data + i, needle);                                    \
+            if (mask != 0)                                                                  \
+                return i + __builtin_ctz(static_cast<unsigned>(mask));                      \
+        }                                                                                   \
+        for (; i < n; i++) {                                                                \
+            if (data[i] == value)                                                           \
+                return i;                                                                   \
+        }                                                                                   \
+        return -1;                                                                          \
+    }                                                                                       \
+                                                                                            \
+    template <typename Ops>                                                                 \
+    Target int simdCount##Suffix(const typename Ops::Scalar* data, int n,                  \
+                                 typename Ops::Scalar value) {                              \
+        typename Ops::Vector needle = Ops::splat(value);                                    \
+        int total = 0;                                                                      \
+        int i = 0;                                                                          \
+        for (; i + Ops::Lanes <= n; i += Ops::Lanes)                                        \
+            total += Ops::bitCount(Ops::equalMask(data + i, needle));                       \
+        for (; i < n; i++) {                                                                \
+            if (data[i] == value)                                                           \
+                total++;                                                                    \
+        }                                                                                   \
+        return total;                                                                       \
+    }
+
+LISTA_SIMD_KERNELS(Sse2, LISTA_SSE2)
+LISTA_SIMD_KERNELS(Avx2, LISTA_AVX2)
+
+#undef LISTA_SIMD_KERNELS
+#undef LISTA_SSE2
+#undef LISTA_AVX2
+
+/*---------------------------------------------------------------
+ * Template da estrutura VectorizedSearch
+ * Descrição: Busca que escolhe, a cada chamada, o laço do nível ativo
+ *            (simdLevel()), com a busca escalar como alternativa.
+ *---------------------------------------------------------------*/
+template <typename T, typename SseOps, typename AvxOps>
+struct VectorizedSearch {
+    static const bool vectorized = true;
+
+    static int find(const T* data, int n, const T& value) {
+        switch (simdLevel()) {
+        case SimdAvx2:
+            return simdFindAvx2<AvxOps>(data, n, value);
+        case SimdSse2:
+            return simdFindSse2<SseOps>(data, n, value);
+        default:
+            return ScalarSearch<T>::find(data, n, value);
+        }
+    }
+
+    static int count(const T* data, int n, const T& value) {
+        switch (simdLevel()) {
+        case SimdAvx2:
+            return simdCountAvx2<AvxOps>(data, n, value);
+        case SimdSse2:
+            return simdCountSse2<SseOps>(data, n, value);
+        default:
+            return ScalarSearch<T>::count(data, n, value);
+        }
+    }
+};
+
+template <>
+struct ValueSearch<int> : VectorizedSearch<int, Sse2IntOps, Avx2IntOps> {};
+
+template <>
+struct ValueSearch<float> : VectorizedSearch<float, Sse2FloatOps, Avx2FloatOps> {};
+
+template <>
+struct ValueSearch<double> : VectorizedSearch<double, Sse2DoubleOps, Avx2DoubleOps> {};
+
+#endif // LISTA_SIMD_X86
+
+#endif // VECTORIZED_SEARCH_H
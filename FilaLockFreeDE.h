@@ -0,0 +1,428 @@
+#ifndef LOCK_FREE_QUEUE_H
+#define LOCK_FREE_QUEUE_H
+
+#include "ListaGenericaDE.h"
+
+#include <atomic>
+#include <new>
+#include <utility>
+#include <vector>
+
+/*
+Descrição:
+Modo fila sem travas (lock-free) para o uso da lista como fila de
+trabalho: produtores chamam push e consumidores chamam popFirst, com a
+mesma semântica de elementos da DoublyLinkedList (FIFO, valores movidos
+para fora na remoção). Implementa a fila de Michael-Scott (MPMC) com
+recuperação de memória por épocas (epoch-based reclamation) e oferece
+drain(out, maxN), que retira até maxN elementos com um único CAS.
+*/
+
+/*---------------------------------------------------------------
+ * Classe EpochReclaimer
+ * Descrição: Recuperação de memória por épocas, compartilhada por
+ *            todas as filas do processo. Uma thread só acessa nós
+ *            compartilhados dentro de um Guard. Um nó retirado na época
+ *            r só é liberado quando a época global chega a r + 2, pois
+ *            nesse ponto toda thread que poderia enxergá-lo já saiu do
+ *            seu Guard.
+ * Glossário:
+ *    - globalEpoch: época global, avança quando todas as threads
+ *                   ativas já anunciaram a época atual.
+ *    - ThreadRecord: estado por thread (época anunciada, se está ativa
+ *                    e os nós retirados, separados em 3 grupos por
+ *                    época). Registros de threads encerradas são
+ *                    reaproveitados, junto com os nós pendentes.
+ *---------------------------------------------------------------*/
+class EpochReclaimer {
+private:
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+    };
+
+    struct ThreadRecord {
+        atomic<unsigned> epoch;
+        atomic<bool> active;
+        atomic<bool> inUse;
+        ThreadRecord* next;            // Imutável após a publicação
+        vector<Retired> retired[3];    // Retirados, agrupados por época % 3
+        unsigned retiredEpoch[3];      // Época de cada grupo
+        int pending;                   // Total de nós retirados pendentes
+        int nesting;                   // Profundidade de Guards aninhados
+
+        ThreadRecord() : epoch(0), active(false), inUse(true), next(nullptr), pending(0), nesting(0) {
+            retiredEpoch[0] = retiredEpoch[1] = retiredEpoch[2] = 0;
+        }
+    };
+
+    // Libera o registro da thread quando ela termina.
+    struct LocalHandle {
+        ThreadRecord* record;
+        LocalHandle() : record(nullptr) {}
+        ~LocalHandle() {
+            if (record != nullptr) {
+                record->active.store(false);
+                record->inUse.store(false, memory_order_release);
+            }
+        }
+    };
+
+    static const int CollectThreshold = 64;
+
+    atomic<unsigned> globalEpoch;
+    atomic<ThreadRecord*> records;
+
+    EpochReclaimer() : globalEpoch(0), records(nullptr) {}
+
+    EpochReclaimer(const EpochReclaimer&);
+    EpochReclaimer& operator=(const EpochReclaimer&);
+
+    static void freeGroup(vector<Retired>& group) {
+        for (size_t i = 0; i < group.size(); i++)
+            group[i].deleter(group[i].ptr);
+        group.clear();
+    }
+
+    // Registro da thread atual (reaproveita um livre ou cria um novo).
+    ThreadRecord* localRecord() {
+        static thread_local LocalHandle handle;
+        if (handle.record != nullptr)
+            return handle.record;
+        for (ThreadRecord* r = records.load(memory_order_acquire); r != nullptr; r = r->next) {
+            bool expected = false;
+            if (!r->inUse.load() && r->inUse.compare_exchange_strong(expected, true, memory_order_acquire)) {
+                handle.record = r;
+                return r;
+            }
+        }
+        ThreadRecord* r = new ThreadRecord;
+        ThreadRecord* head = records.load();
+        do {
+            r->next = head;
+        } while (!records.compare_exchange_weak(head, r, memory_order_release));
+        handle.record = r;
+        return r;
+    }
+
+    // Avança a época global se todas as threads ativas já a anunciaram.
+    void tryAdvance() {
+        unsigned e = globalEpoch.load();
+        atomic_thread_fence(memory_order_seq_cst);
+        for (ThreadRecord* r = records.load(memory_order_acquire); r != nullptr; r = r->next) {
+            if (r->active.load() && r->epoch.load() != e)
+                return;
+        }
+        globalEpoch.compare_exchange_strong(e, e + 1);
+    }
+
+    // Libera os grupos da thread cuja época já ficou duas para trás.
+    void collect(ThreadRecord* r) {
+        unsigned e = globalEpoch.load();
+        for (int g = 0; g < 3; g++) {
+            if (!r->retired[g].empty() && e - r->retiredEpoch[g] >= 2) {
+                r->pending -= static_cast<int>(r->retired[g].size());
+                freeGroup(r->retired[g]);
+            }
+        }
+    }
+
+public:
+    static EpochReclaimer& instance() {
+        static EpochReclaimer domain;
+        return domain;
+    }
+
+    // Ao final do processo não há mais threads usando os nós.
+    ~EpochReclaimer() {
+        ThreadRecord* r = records.load();
+        while (r != nullptr) {
+            ThreadRecord* next = r->next;
+            for (int g = 0; g < 3; g++)
+                freeGroup(r->retired[g]);
+            delete r;
+            r = next;
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Classe Guard
+     * Descrição: Marca (RAII) o trecho em que a thread acessa nós
+     *            compartilhados. Pode ser aninhado.
+     *---------------------------------------------------------------*/
+    class Guard {
+    private:
+        EpochReclaimer& domain;
+        ThreadRecord* record;
+
+        Guard(const Guard&);
+        Guard& operator=(const Guard&);
+
+    public:
+        explicit Guard(EpochReclaimer& d) : domain(d), record(d.localRecord()) {
+            if (record->nesting++ == 0) {
+                record->epoch.store(domain.globalEpoch.load(), memory_order_relaxed);
+                record->active.store(true, memory_order_relaxed);
+                atomic_thread_fence(memory_order_seq_cst);
+            }
+        }
+
+        ~Guard() {
+            if (--record->nesting == 0)
+                record->active.store(false, memory_order_release);
+        }
+    };
+
+    /*---------------------------------------------------------------
+     * Função retire()
+     * Descrição: Agenda a liberação de ptr (já inalcançável para novas
+     *            leituras) por deleter, assim que for seguro.
+     *---------------------------------------------------------------*/
+    void retire(void* ptr, void (*deleter)(void*)) {
+        ThreadRecord* r = localRecord();
+        unsigned e = globalEpoch.load();
+        int g = static_cast<int>(e % 3);
+        if (r->retiredEpoch[g] != e) {
+            // O grupo guarda nós de pelo menos 3 épocas atrás: já é seguro
+            r->pending -= static_cast<int>(r->retired[g].size());
+            freeGroup(r->retired[g]);
+            r->retiredEpoch[g] = e;
+        }
+        Retired item = { ptr, deleter };
+        r->retired[g].push_back(item);
+        r->pending++;
+        if (r->pending >= CollectThreshold) {
+            tryAdvance();
+            collect(r);
+        }
+    }
+};
+
+/*---------------------------------------------------------------
+ * Classe LockFreeQueue
+ * Descrição: Fila FIFO sem travas para vários produtores e vários
+ *            consumidores (Michael-Scott). head aponta sempre para um
+ *            nó sentinela já consumido; os elementos ficam nos nós
+ *            seguintes. O valor é movido para fora pelo consumidor que
+ *            vence o CAS em head, e o nó sentinela antigo é entregue ao
+ *            EpochReclaimer.
+ *---------------------------------------------------------------*/
+template <typename T>
+class LockFreeQueue {
+private:
+    struct QueueNode {
+        atomic<QueueNode*> next;
+        typename aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        QueueNode() : next(nullptr) {}
+
+        T& value() {
+            return *reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    atomic<QueueNode*> head;   // Sentinela (nó já consumido)
+    atomic<QueueNode*> tail;   // Último nó ou um nó próximo dele
+
+    LockFreeQueue(const LockFreeQueue&);
+    LockFreeQueue& operator=(const LockFreeQueue&);
+
+    static void deleteNode(void* node) {
+        delete static_cast<QueueNode*>(node);
+    }
+
+    // Encadeia um nó já construído no final da fila.
+    void enqueue(QueueNode* node) {
+        EpochReclaimer::Guard guard(EpochReclaimer::instance());
+        for (;;) {
+            QueueNode* t = tail.load(memory_order_acquire);
+            QueueNode* next = t->next.load(memory_order_acquire);
+            if (t != tail.load(memory_order_acquire))
+                continue;
+            if (next == nullptr) {
+                if (t->next.compare_exchange_weak(next, node, memory_order_release, memory_order_relaxed)) {
+                    tail.compare_exchange_strong(t, node, memory_order_release, memory_order_relaxed);
+                    return;
+                }
+            } else {
+                // tail ficou para trás: ajuda a avançá-lo
+                tail.compare_exchange_strong(t, next, memory_order_release, memory_order_relaxed);
+            }
+        }
+    }
+
+    // Move o valor do nó para fora e o destrói.
+    static T takeValue(QueueNode* node) {
+        T value(std::move(node->value()));
+        node->value().~T();
+        return value;
+    }
+
+public:
+    // Construtor da fila: cria o sentinela inicial.
+    LockFreeQueue() {
+        QueueNode* dummy = new QueueNode;
+        head.store(dummy);
+        tail.store(dummy);
+    }
+
+    // Destrutor: não pode haver outras threads usando a fila.
+    ~LockFreeQueue() {
+        QueueNode* node = head.load();
+        QueueNode* next = node->next.load();
+        delete node; // Sentinela: sem valor construído
+        while (next != nullptr) {
+            node = next;
+            next = node->next.load();
+            node->value().~T();
+            delete node;
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Função push()
+     * Descrição: Insere um elemento no final da fila (sem travas).
+     *---------------------------------------------------------------*/
+    void push(const T& value) {
+        emplace_back(value);
+    }
+
+    void push(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        QueueNode* node = new QueueNode;
+        try {
+            new (&node->storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            delete node;
+            throw;
+        }
+        enqueue(node);
+    }
+
+    /*---------------------------------------------------------------
+     * Função tryPopFirst()
+     * Descrição: Remove o primeiro elemento, movendo-o para 'out'.
+     * Retorno:
+     *    - false se a fila estava vazia.
+     *---------------------------------------------------------------*/
+    bool tryPopFirst(T& out) {
+        EpochReclaimer::Guard guard(EpochReclaimer::instance());
+        for (;;) {
+            QueueNode* h = head.load(memory_order_acquire);
+            QueueNode* t = tail.load(memory_order_acquire);
+            QueueNode* next = h->next.load(memory_order_acquire);
+            if (h != head.load(memory_order_acquire))
+                continue;
+            if (next == nullptr)
+                return false;
+            if (h == t) {
+                // tail ficou para trás: ajuda antes de avançar head
+                tail.compare_exchange_strong(t, next, memory_order_release, memory_order_relaxed);
+                continue;
+            }
+            if (head.compare_exchange_weak(h, next, memory_order_acq_rel, memory_order_relaxed)) {
+                // Só o vencedor do CAS acessa o valor de 'next' (novo sentinela)
+                out = takeValue(next);
+                EpochReclaimer::instance().retire(h, &deleteNode);
+                return true;
+            }
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Função popFirst()
+     * Descrição: Remove e retorna o primeiro elemento da fila.
+     *            Lança underflow_error se a fila estiver vazia, como a
+     *            DoublyLinkedList.
+     *---------------------------------------------------------------*/
+    T popFirst() {
+        EpochReclaimer::Guard guard(EpochReclaimer::instance());
+        for (;;) {
+            QueueNode* h = head.load(memory_order_acquire);
+            QueueNode* t = tail.load(memory_order_acquire);
+            QueueNode* next = h->next.load(memory_order_acquire);
+            if (h != head.load(memory_order_acquire))
+                continue;
+            if (next == nullptr)
+                throw underflow_error("Lista vazia. Não há elementos para remover.");
+            if (h == t) {
+                tail.compare_exchange_strong(t, next, memory_order_release, memory_order_relaxed);
+                continue;
+            }
+            if (head.compare_exchange_weak(h, next, memory_order_acq_rel, memory_order_relaxed)) {
+                T value = takeValue(next);
+                EpochReclaimer::instance().retire(h, &deleteNode);
+                return value;
+            }
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Função drain()
+     * Descrição: Retira em lote até maxN elementos com um único CAS em
+     *            head e os escreve, em ordem, no iterador de saída 'out'
+     *            (por exemplo back_inserter de um vector).
+     * Retorno:
+     *    - quantidade de elementos retirados (0 se a fila estava vazia).
+     *---------------------------------------------------------------*/
+    template <typename OutputIt>
+    int drain(OutputIt out, int maxN) {
+        if (maxN <= 0)
+            return 0;
+        EpochReclaimer::Guard guard(EpochReclaimer::instance());
+        for (;;) {
+            QueueNode* h = head.load(memory_order_acquire);
+            QueueNode* t = tail.load(memory_order_acquire);
+            // Percorre até maxN nós a partir do sentinela
+            QueueNode* last = h;
+            bool tailBehind = false;   // tail está antes do novo sentinela?
+            int count = 0;
+            while (count < maxN) {
+                QueueNode* next = last->next.load(memory_order_acquire);
+                if (next == nullptr)
+                    break;
+                if (last == t)
+                    tailBehind = true;
+                last = next;
+                count++;
+            }
+            if (h != head.load(memory_order_acquire))
+                continue;
+            if (count == 0)
+                return 0;
+            if (tailBehind) {
+                // head não pode ultrapassar tail: ajuda tail a avançar e repete
+                tail.compare_exchange_strong(t, t->next.load(memory_order_acquire),
+                                             memory_order_release, memory_order_relaxed);
+                continue;
+            }
+            if (head.compare_exchange_weak(h, last, memory_order_acq_rel, memory_order_relaxed)) {
+                // Os nós (h, last] agora pertencem só a esta thread
+                QueueNode* node = h;
+                for (int i = 0; i < count; i++) {
+                    QueueNode* next = node->next.load(memory_order_acquire);
+                    *out = takeValue(next);
+                    ++out;
+                    EpochReclaimer::instance().retire(node, &deleteNode);
+                    node = next;
+                }
+                return count;
+            }
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Função empty()
+     * Descrição: Indica se a fila estava vazia no instante da chamada.
+     *---------------------------------------------------------------*/
+    bool empty() const {
+        EpochReclaimer::Guard guard(EpochReclaimer::instance());
+        return head.load(memory_order_acquire)->next.load(memory_order_acquire) == nullptr;
+    }
+};
+
+#endif // LOCK_FREE_QUEUE_H
@@ -0,0 +1,1084 @@
+#ifndef COMPACT_DOUBLY_LINKED_LIST_H
+#define COMPACT_DOUBLY_LINKED_LIST_H
+
+#include "ListaGenericaDE.h"
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+Descrição:
+Layout compacto da lista duplamente encadeada. Os nós ficam em um único
+vetor crescente e se ligam por índices de 32 bits em vez de ponteiros de
+64 bits: para int cada nó ocupa 12 bytes (contra 24 bytes do Node<int>
+mais o cabeçalho do malloc de cada alocação). Posições liberadas voltam
+para uma free-list dentro do próprio vetor.
+A interface pública é a mesma da DoublyLinkedList (push, insertAt,
+popAt, move, operator[], sort, merge, iteradores, deslocate, splice,
+...). Diferenças:
+  - referências e ponteiros para os elementos são invalidados quando o
+    vetor cresce (os iteradores, que guardam índices, continuam
+    válidos até o elemento ser removido);
+  - os nós não podem trocar de vetor: deslocate, splice e merge entre
+    listas diferentes movem os valores para nós da lista de destino.
+*/
+
+/*---------------------------------------------------------------
+ * Template da estrutura CompactSlot
+ * Descrição: Posição do vetor de nós da lista compacta.
+ * Glossário:
+ *    - storage: armazenamento bruto do dado (construído apenas quando
+ *               a posição está em uso).
+ *    - next: próximo nó (ou próxima posição livre, na free-list).
+ *    - prev: nó anterior (FreeSlot quando a posição está livre).
+ *---------------------------------------------------------------*/
+template <typename T>
+struct CompactSlot {
+    typename aligned_storage<sizeof(T), alignof(T)>::type storage;
+    uint32_t next;
+    uint32_t prev;
+};
+
+/*---------------------------------------------------------------
+ * Classe CompactDoublyLinkedList
+ * Descrição: Lista duplamente encadeada com nós em um vetor e ligações
+ *            por índices de 32 bits (até 2^32 - 2 nós).
+ * Parâmetros do template:
+ *    - T: tipo do dado armazenado.
+ *    - Instrumentation: política de métricas (NoInstrumentation ou
+ *                       CountingInstrumentation).
+ *---------------------------------------------------------------*/
+template <typename T, typename Instrumentation = NoInstrumentation>
+class CompactDoublyLinkedList {
+private:
+    typedef CompactSlot<T> Slot;
+
+    static const uint32_t Null = 0xFFFFFFFFu;       // Ausência de nó
+    static const uint32_t FreeSlot = 0xFFFFFFFEu;   // Marca de posição livre
+
+    Slot* slots;          // Vetor de nós
+    uint32_t capacity;    // Posições reservadas em slots
+    uint32_t used;        // Posições [0, used) já entregues alguma vez
+    uint32_t freeList;    // Primeira posição livre para reuso
+    uint32_t head;        // Índice do primeiro nó da lista
+    uint32_t tail;        // Índice do último nó da lista
+    int size;             // Número de elementos presentes na lista
+    mutable Instrumentation metrics; // Política de métricas
+
+    template <typename U, typename M>
+    friend void deslocate(CompactDoublyLinkedList<U, M>& source, CompactDoublyLinkedList<U, M>& dest, int index, int newIndex);
+    template <typename U, typename M>
+    friend void splice(CompactDoublyLinkedList<U, M>& dest, int pos, CompactDoublyLinkedList<U, M>& source, int first, int last);
+
+    T& valueAt(uint32_t i) {
+        return *reinterpret_cast<T*>(&slots[i].storage);
+    }
+
+    const T& valueAt(uint32_t i) const {
+        return *reinterpret_cast<const T*>(&slots[i].storage);
+    }
+
+    // Método auxiliar para obter o índice do nó na posição index.
+    // Percorre a partir da extremidade (head ou tail) mais próxima.
+    // Lança exceção se o índice estiver fora dos limites da lista.
+    uint32_t getSlotAt(int index) const {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        uint32_t current;
+        if (index < size / 2) {
+            current = head;
+            for (int i = 0; i < index; i++)
+                current = slots[current].next;
+            metrics.traversed(index);
+        } else {
+            current = tail;
+            for (int i = size - 1; i > index; i--)
+                current = slots[current].prev;
+            metrics.traversed(size - 1 - index);
+        }
+        return current;
+    }
+
+    // Método auxiliar para buscar o primeiro nó com o valor especificado.
+    // Retorna Null se não encontrar.
+    uint32_t getSlotByValue(const T& value) const {
+        int steps = 0;
+        uint32_t current = head;
+        while (current != Null && !(valueAt(current) == value)) {
+            current = slots[current].next;
+            steps++;
+        }
+        metrics.traversed(steps);
+        return current;
+    }
+
+    // Método auxiliar para mover os nós em uso para um vetor com
+    // newCapacity posições. Se 'pending' não for nulo, o novo elemento
+    // é construído na posição 'used' do novo vetor antes da realocação
+    // (args pode referenciar um elemento do vetor antigo).
+    template <typename... Args>
+    void reallocate(uint32_t newCapacity, bool constructPending, Args&&... args) {
+        Slot* fresh = static_cast<Slot*>(::operator new(sizeof(Slot) * newCapacity));
+        uint32_t moved = 0;
+        try {
+            if (constructPending)
+                new (&fresh[used].storage) T(std::forward<Args>(args)...);
+            try {
+                for (; moved < used; moved++) {
+                    fresh[moved].next = slots[moved].next;
+                    fresh[moved].prev = slots[moved].prev;
+                    if (slots[moved].prev != FreeSlot)
+                        new (&fresh[moved].storage) T(std::move_if_noexcept(valueAt(moved)));
+                }
+            } catch (...) {
+                for (uint32_t i = 0; i < moved; i++) {
+                    if (fresh[i].prev != FreeSlot)
+                        reinterpret_cast<T*>(&fresh[i].storage)->~T();
+                }
+                if (constructPending)
+                    reinterpret_cast<T*>(&fresh[used].storage)->~T();
+                throw;
+            }
+        } catch (...) {
+            ::operator delete(fresh);
+            throw;
+        }
+        releaseSlots();
+        slots = fresh;
+        capacity = newCapacity;
+    }
+
+    // Método auxiliar para destruir os dados em uso e liberar o vetor.
+    void releaseSlots() {
+        if (!is_trivially_destructible<T>::value) {
+            for (uint32_t i = 0; i < used; i++) {
+                if (slots[i].prev != FreeSlot)
+                    valueAt(i).~T();
+            }
+        }
+        ::operator delete(slots);
+        slots = nullptr;
+    }
+
+    // Método auxiliar para criar um nó (desligado) repassando args ao
+    // construtor de T. Reaproveita a free-list ou, se preciso, dobra o
+    // vetor. Retorna o índice do nó.
+    template <typename... Args>
+    uint32_t createSlot(Args&&... args) {
+        uint32_t index;
+        if (freeList != Null) {
+            index = freeList;
+            new (&slots[index].storage) T(std::forward<Args>(args)...);
+            freeList = slots[index].next;
+        } else if (used < capacity) {
+            index = used;
+            new (&slots[index].storage) T(std::forward<Args>(args)...);
+            used++;
+        } else {
+            if (capacity >= FreeSlot)
+                throw length_error("Lista compacta cheia.");
+            uint32_t newCapacity = (capacity == 0) ? 8 : (capacity > FreeSlot / 2 ? FreeSlot : capacity * 2);
+            reallocate(newCapacity, true, std::forward<Args>(args)...);
+            index = used++;
+        }
+        slots[index].next = Null;
+        slots[index].prev = Null;
+        metrics.allocated();
+        return index;
+    }
+
+    // Método auxiliar para destruir o dado do nó e devolver a posição à
+    // free-list.
+    void destroySlot(uint32_t index) {
+        valueAt(index).~T();
+        slots[index].prev = FreeSlot;
+        slots[index].next = freeList;
+        freeList = index;
+        metrics.freed(1);
+    }
+
+    // Método auxiliar para desanexar a sequência contígua [first, last]
+    // (com count nós) sem liberar as posições.
+    void unlinkRange(uint32_t first, uint32_t last, int count) {
+        if (slots[first].prev != Null)
+            slots[slots[first].prev].next = slots[last].next;
+        else
+            head = slots[last].next;
+        if (slots[last].next != Null)
+            slots[slots[last].next].prev = slots[first].prev;
+        else
+            tail = slots[first].prev;
+        slots[first].prev = Null;
+        slots[last].next = Null;
+        size -= count;
+    }
+
+    // Método auxiliar para anexar a sequência [first, last] (com count
+    // nós) antes de refSlot. Se refSlot for Null, anexa ao final.
+    void linkRangeBefore(uint32_t first, uint32_t last, int count, uint32_t refSlot) {
+        slots[last].next = refSlot;
+        slots[first].prev = (refSlot != Null) ? slots[refSlot].prev : tail;
+        if (slots[first].prev != Null)
+            slots[slots[first].prev].next = first;
+        else
+            head = first;
+        if (refSlot != Null)
+            slots[refSlot].prev = last;
+        else
+            tail = last;
+        size += count;
+    }
+
+    void unlinkSlot(uint32_t index) {
+        unlinkRange(index, index, 1);
+    }
+
+    void linkSlotBefore(uint32_t index, uint32_t refSlot) {
+        linkRangeBefore(index, index, 1, refSlot);
+    }
+
+    // Método auxiliar para remover (desanexar e liberar) um nó.
+    void removeSlot(uint32_t index) {
+        unlinkSlot(index);
+        destroySlot(index);
+    }
+
+    // Método auxiliar para liberar a cadeia desanexada iniciada em first.
+    void destroyChain(uint32_t first) {
+        while (first != Null) {
+            uint32_t next = slots[first].next;
+            destroySlot(first);
+            first = next;
+        }
+    }
+
+    // Método auxiliar para criar, em uma passada, a cadeia desanexada com
+    // os valores de [first, last). Retorna a quantidade de nós criados;
+    // se a criação de algum falhar, os já criados são liberados.
+    template <typename InputIt>
+    int buildChain(InputIt first, InputIt last, uint32_t& chainFirst, uint32_t& chainLast) {
+        chainFirst = Null;
+        chainLast = Null;
+        int count = 0;
+        try {
+            for (; first != last; ++first) {
+                uint32_t index = createSlot(*first);
+                slots[index].prev = chainLast;
+                if (chainLast != Null)
+                    slots[chainLast].next = index;
+                else
+                    chainFirst = index;
+                chainLast = index;
+                count++;
+            }
+        } catch (...) {
+            destroyChain(chainFirst);
+            throw;
+        }
+        return count;
+    }
+
+    // Método auxiliar para criar nesta lista a cadeia com os valores
+    // (movidos) dos nós [first, last] de 'from', que devem estar
+    // desanexados. Os nós de 'from' são liberados.
+    void adoptChain(CompactDoublyLinkedList& from, uint32_t& first, uint32_t& last) {
+        uint32_t newFirst = Null;
+        uint32_t newLast = Null;
+        uint32_t current = first;
+        try {
+            while (current != Null) {
+                uint32_t copy = createSlot(std::move(from.valueAt(current)));
+                slots[copy].prev = newLast;
+                if (newLast != Null)
+                    slots[newLast].next = copy;
+                else
+                    newFirst = copy;
+                newLast = copy;
+                uint32_t next = from.slots[current].next;
+                from.destroySlot(current);
+                current = next;
+            }
+        } catch (...) {
+            destroyChain(newFirst);
+            from.destroyChain(current);
+            throw;
+        }
+        first = newFirst;
+        last = newLast;
+    }
+
+    // Método auxiliar para intercalar, de forma estável, as cadeias
+    // ordenadas 'a' e 'b' (ligadas apenas por next). O resultado fica em
+    // 'a'; se comp lançar exceção, 'a' recebe todos os nós.
+    template <typename Compare>
+    void mergeChains(uint32_t& a, uint32_t b, Compare& comp) {
+        uint32_t first = Null;
+        uint32_t* link = &first;
+        try {
+            while (a != Null && b != Null) {
+                if (comp(valueAt(b), valueAt(a))) {
+                    *link = b;
+                    link = &slots[b].next;
+                    b = slots[b].next;
+                } else {
+                    *link = a;
+                    link = &slots[a].next;
+                    a = slots[a].next;
+                }
+            }
+        } catch (...) {
+            *link = a;
+            appendChain(first, b);
+            a = first;
+            throw;
+        }
+        *link = (a != Null) ? a : b;
+        a = first;
+    }
+
+    // Método auxiliar para anexar 'chain' ao final da cadeia 'first'.
+    void appendChain(uint32_t& first, uint32_t chain) {
+        uint32_t* link = &first;
+        while (*link != Null)
+            link = &slots[*link].next;
+        *link = chain;
+    }
+
+    // Método auxiliar para refazer prev, head e tail a partir da cadeia
+    // 'first' ligada apenas por next.
+    void relinkChain(uint32_t first) {
+        head = first;
+        uint32_t prev = Null;
+        for (uint32_t current = first; current != Null; current = slots[current].next) {
+            slots[current].prev = prev;
+            prev = current;
+        }
+        tail = prev;
+    }
+
+    // Método auxiliar para localizar o primeiro nó maior que 'value'
+    // (Null para o final); compara primeiro com o tail.
+    template <typename Compare>
+    uint32_t upperBound(const T& value, Compare& comp) const {
+        if (tail == Null || !comp(value, valueAt(tail)))
+            return Null;
+        int steps = 0;
+        uint32_t current = head;
+        while (!comp(value, valueAt(current))) {
+            current = slots[current].next;
+            steps++;
+        }
+        metrics.traversed(steps);
+        return current;
+    }
+
+    // Método auxiliar para inserir 'value' à direita ('d') ou à
+    // esquerda ('r') do nó refSlot.
+    void insertBeside(uint32_t refSlot, const T& value, char side) {
+        if (side == 'd')
+            linkSlotBefore(createSlot(value), slots[refSlot].next);
+        else if (side == 'r')
+            linkSlotBefore(createSlot(value), refSlot);
+        else
+            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
+    }
+
+    // Método auxiliar para remover o nó à direita ('d') ou à esquerda
+    // ('r') de refSlot.
+    void removeBeside(uint32_t refSlot, char side) {
+        if (side == 'd') {
+            if (slots[refSlot].next == Null)
+                throw runtime_error("Não há nó à direita para remover.");
+            removeSlot(slots[refSlot].next);
+        } else if (side == 'r') {
+            if (slots[refSlot].prev == Null)
+                throw runtime_error("Não há nó à esquerda para remover.");
+            removeSlot(slots[refSlot].prev);
+        } else {
+            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
+        }
+    }
+
+    // Método auxiliar para ligar um nó já criado na posição index.
+    void insertSlotAt(uint32_t index, int position) {
+        if (position < 0 || position > size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        linkSlotBefore(index, (position == size) ? Null : getSlotAt(position));
+    }
+
+public:
+    /*---------------------------------------------------------------
+     * Classe BasicIterator
+     * Descrição: Iterador bidirecional; guarda o índice do nó, por
+     *            isso continua válido quando o vetor cresce.
+     *---------------------------------------------------------------*/
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        typedef bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef typename conditional<IsConst, const T*, T*>::type pointer;
+        typedef typename conditional<IsConst, const T&, T&>::type reference;
+
+        BasicIterator() : index(Null), list(nullptr) {}
+
+        template <bool OtherConst>
+        BasicIterator(const BasicIterator<OtherConst>& other,
+                      typename enable_if<IsConst && !OtherConst>::type* = nullptr)
+            : index(other.index), list(other.list) {}
+
+        reference operator*() const { return const_cast<CompactDoublyLinkedList*>(list)->valueAt(index); }
+        pointer operator->() const { return &**this; }
+
+        BasicIterator& operator++() {
+            index = list->slots[index].next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator copy(*this);
+            ++(*this);
+            return copy;
+        }
+
+        BasicIterator& operator--() {
+            index = (index == Null) ? list->tail : list->slots[index].prev;
+            return *this;
+        }
+
+        BasicIterator operator--(int) {
+            BasicIterator copy(*this);
+            --(*this);
+            return copy;
+        }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) { return a.index == b.index; }
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) { return a.index != b.index; }
+
+    private:
+        friend class CompactDoublyLinkedList;
+        template <bool> friend class BasicIterator;
+
+        uint32_t index;                          // Nó atual (Null representa end())
+        const CompactDoublyLinkedList* list;     // Lista percorrida
+
+        BasicIterator(uint32_t i, const CompactDoublyLinkedList* l) : index(i), list(l) {}
+    };
+
+    typedef BasicIterator<false> iterator;
+    typedef BasicIterator<true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    // Construtor da lista: inicializa uma lista vazia (sem alocar).
+    CompactDoublyLinkedList()
+        : slots(nullptr), capacity(0), used(0), freeList(Null), head(Null), tail(Null), size(0) {}
+
+    // Construtor a partir de um intervalo de iteradores [first, last).
+    template <typename InputIt>
+    CompactDoublyLinkedList(InputIt first, InputIt last)
+        : slots(nullptr), capacity(0), used(0), freeList(Null), head(Null), tail(Null), size(0) {
+        pushRange(first, last);
+    }
+
+    // Construtor a partir de uma lista de inicialização: {1, 2, 3}.
+    CompactDoublyLinkedList(initializer_list<T> values)
+        : slots(nullptr), capacity(0), used(0), freeList(Null), head(Null), tail(Null), size(0) {
+        reserve(static_cast<int>(values.size()));
+        pushRange(values.begin(), values.end());
+    }
+
+    // Construtor de cópia: copia os elementos na ordem da lista, em
+    // posições contíguas de um vetor do tamanho exato.
+    CompactDoublyLinkedList(const CompactDoublyLinkedList& other)
+        : slots(nullptr), capacity(0), used(0), freeList(Null), head(Null), tail(Null), size(0) {
+        reserve(other.size);
+        pushRange(other.begin(), other.end());
+    }
+
+    // Construtor de movimentação: assume o vetor de 'other' em O(1).
+    CompactDoublyLinkedList(CompactDoublyLinkedList&& other)
+        : slots(other.slots), capacity(other.capacity), used(other.used), freeList(other.freeList),
+          head(other.head), tail(other.tail), size(other.size) {
+        other.slots = nullptr;
+        other.capacity = 0;
+        other.used = 0;
+        other.freeList = Null;
+        other.head = Null;
+        other.tail = Null;
+        other.size = 0;
+    }
+
+    // Destrutor: destrói os elementos e libera o vetor de uma vez.
+    ~CompactDoublyLinkedList() {
+        metrics.freed(size);
+        releaseSlots();
+    }
+
+    CompactDoublyLinkedList& operator=(const CompactDoublyLinkedList& other) {
+        if (this != &other) {
+            CompactDoublyLinkedList copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    CompactDoublyLinkedList& operator=(CompactDoublyLinkedList&& other) {
+        if (this != &other) {
+            CompactDoublyLinkedList moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    /*---------------------------------------------------------------
+     * Função swap()
+     * Descrição: Troca o conteúdo (vetor de nós) com outra lista em O(1).
+     *---------------------------------------------------------------*/
+    void swap(CompactDoublyLinkedList& other) {
+        std::swap(slots, other.slots);
+        std::swap(capacity, other.capacity);
+        std::swap(used, other.used);
+        std::swap(freeList, other.freeList);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(size, other.size);
+    }
+
+    /*---------------------------------------------------------------
+     * Função reserve()
+     * Descrição: Garante espaço para 'count' elementos sem realocar.
+     *---------------------------------------------------------------*/
+    void reserve(int count) {
+        if (count > 0 && static_cast<uint32_t>(count) > capacity)
+            reallocate(static_cast<uint32_t>(count), false);
+    }
+
+    /*---------------------------------------------------------------
+     * Função memoryUsage()
+     * Descrição: Bytes ocupados pela lista: o vetor de nós reservado
+     *            mais o próprio objeto.
+     *---------------------------------------------------------------*/
+    size_t memoryUsage() const {
+        return sizeof(*this) + sizeof(Slot) * capacity;
+    }
+
+    void push(const T& value) {
+        emplace_back(value);
+    }
+
+    void push(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    void pushFirst(const T& value) {
+        emplace_front(value);
+    }
+
+    void pushFirst(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Push);
+        uint32_t index = createSlot(std::forward<Args>(args)...);
+        linkSlotBefore(index, Null);
+        return valueAt(index);
+    }
+
+    template <typename... Args>
+    T& emplace_front(Args&&... args) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PushFirst);
+        uint32_t index = createSlot(std::forward<Args>(args)...);
+        linkSlotBefore(index, head);
+        return valueAt(index);
+    }
+
+    template <typename... Args>
+    T& emplace_at(int position, Args&&... args) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::InsertAt);
+        if (position < 0 || position > size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        uint32_t index = createSlot(std::forward<Args>(args)...);
+        insertSlotAt(index, position);
+        return valueAt(index);
+    }
+
+    void push(const T& refValue, char side) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PushBeside);
+        uint32_t refSlot = getSlotByValue(refValue);
+        if (refSlot == Null)
+            throw runtime_error("Valor de referência não encontrado na lista.");
+        insertBeside(refSlot, refValue, side);
+    }
+
+    void push(int index, const T& value, char side) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PushBeside);
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        insertBeside(getSlotAt(index), value, side);
+    }
+
+    void insertAt(int index, const T& value) {
+        emplace_at(index, value);
+    }
+
+    void insertAt(int index, T&& value) {
+        emplace_at(index, std::move(value));
+    }
+
+    void pop() {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Pop);
+        if (size == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        removeSlot(tail);
+    }
+
+    void popFirst() {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopFirst);
+        if (size == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        removeSlot(head);
+    }
+
+    void popByValue(const T& value) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopByValue);
+        uint32_t index = getSlotByValue(value);
+        if (index == Null)
+            throw runtime_error("Valor não encontrado na lista.");
+        removeSlot(index);
+    }
+
+    void popByValue(const T& value, char side) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopBeside);
+        uint32_t refSlot = getSlotByValue(value);
+        if (refSlot == Null)
+            throw runtime_error("Valor de referência não encontrado na lista.");
+        removeBeside(refSlot, side);
+    }
+
+    void pop(int index, char side) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopBeside);
+        if (size < 2)
+            throw runtime_error("Não é possível remover nó adjacente em uma lista com um único elemento.");
+        removeBeside(getSlotAt(index), side);
+    }
+
+    T popAt(int index) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopAt);
+        uint32_t slot = getSlotAt(index);
+        T value(std::move(valueAt(slot)));
+        removeSlot(slot);
+        return value;
+    }
+
+    void move(int index, int newIndex) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Move);
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice original fora dos limites da lista.");
+        if (newIndex < 0 || newIndex > size - 1)
+            throw out_of_range("Novo índice fora dos limites da lista.");
+        if (index == newIndex)
+            return; // Sem alteração
+        uint32_t slot = getSlotAt(index);
+        unlinkSlot(slot);
+        // Mesma convenção da DoublyLinkedList: newIndex é contado antes
+        // da remoção do nó
+        if (index < newIndex)
+            newIndex--;
+        insertSlotAt(slot, newIndex);
+    }
+
+    T& operator[](int index) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Get);
+        return valueAt(getSlotAt(index));
+    }
+
+    const T& operator[](int index) const {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Get);
+        return valueAt(getSlotAt(index));
+    }
+
+    T& get(int index) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Get);
+        return valueAt(getSlotAt(index));
+    }
+
+    const T& get(int index) const {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Get);
+        return valueAt(getSlotAt(index));
+    }
+
+    void set(int index, const T& value) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Set);
+        valueAt(getSlotAt(index)) = value;
+    }
+
+    void set(int index, T&& value) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Set);
+        valueAt(getSlotAt(index)) = std::move(value);
+    }
+
+    template <typename InputIt>
+    int pushRange(InputIt first, InputIt last) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PushRange);
+        uint32_t chainFirst, chainLast;
+        int count = buildChain(first, last, chainFirst, chainLast);
+        if (count > 0)
+            linkRangeBefore(chainFirst, chainLast, count, Null);
+        return count;
+    }
+
+    template <typename InputIt>
+    int insertRange(int index, InputIt first, InputIt last) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::InsertRange);
+        if (index < 0 || index > size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        uint32_t refSlot = (index == size) ? Null : getSlotAt(index);
+        uint32_t chainFirst, chainLast;
+        int count = buildChain(first, last, chainFirst, chainLast);
+        if (count > 0)
+            linkRangeBefore(chainFirst, chainLast, count, refSlot);
+        return count;
+    }
+
+    template <typename Predicate>
+    int removeIf(Predicate pred) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::RemoveIf);
+        int removed = 0;
+        metrics.traversed(size);
+        uint32_t current = head;
+        while (current != Null) {
+            uint32_t next = slots[current].next;
+            if (pred(valueAt(current))) {
+                removeSlot(current);
+                removed++;
+            }
+            current = next;
+        }
+        return removed;
+    }
+
+    int removeAll(const T& value) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::RemoveIf);
+        int removed = 0;
+        uint32_t deferred = Null;
+        metrics.traversed(size);
+        uint32_t current = head;
+        while (current != Null) {
+            uint32_t next = slots[current].next;
+            if (valueAt(current) == value) {
+                if (&valueAt(current) == &value)
+                    deferred = current;
+                else
+                    removeSlot(current);
+                removed++;
+            }
+            current = next;
+        }
+        if (deferred != Null)
+            removeSlot(deferred);
+        return removed;
+    }
+
+    /*---------------------------------------------------------------
+     * Função clear()
+     * Descrição: Remove todos os elementos. O vetor reservado é mantido
+     *            para as próximas inserções.
+     *---------------------------------------------------------------*/
+    void clear() {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Clear);
+        metrics.freed(size);
+        if (!is_trivially_destructible<T>::value) {
+            for (uint32_t current = head; current != Null; current = slots[current].next)
+                valueAt(current).~T();
+        }
+        used = 0;
+        freeList = Null;
+        head = Null;
+        tail = Null;
+        size = 0;
+    }
+
+    void sort() {
+        sort(less<T>());
+    }
+
+    template <typename Compare>
+    void sort(Compare comp) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Sort);
+        if (size < 2)
+            return;
+        // bins[i]: sequência ordenada com 2^i nós (ou vazia), como em
+        // DoublyLinkedList::sort
+        const int MaxBins = 33;
+        uint32_t bins[MaxBins];
+        for (int i = 0; i < MaxBins; i++)
+            bins[i] = Null;
+        int fill = 0;
+        uint32_t rest = head;
+        uint32_t carry = Null;
+        try {
+            while (rest != Null) {
+                carry = rest;
+                rest = slots[rest].next;
+                slots[carry].next = Null;
+                int i = 0;
+                for (; i < fill && bins[i] != Null; i++) {
+                    uint32_t newer = carry;
+                    carry = Null;
+                    mergeChains(bins[i], newer, comp);
+                    carry = bins[i];
+                    bins[i] = Null;
+                }
+                bins[i] = carry;
+                carry = Null;
+                if (i == fill)
+                    fill++;
+            }
+            for (int i = 0; i < fill; i++) {
+                if (bins[i] == Null)
+                    continue;
+                uint32_t newer = carry;
+                carry = Null;
+                mergeChains(bins[i], newer, comp);
+                carry = bins[i];
+                bins[i] = Null;
+            }
+        } catch (...) {
+            for (int i = 0; i < fill; i++)
+                appendChain(carry, bins[i]);
+            appendChain(carry, rest);
+            relinkChain(carry);
+            throw;
+        }
+        relinkChain(carry);
+    }
+
+    void merge(CompactDoublyLinkedList& other) {
+        merge(other, less<T>());
+    }
+
+    /*---------------------------------------------------------------
+     * Função merge()
+     * Descrição: Intercala em O(n + m) a lista ordenada 'other' nesta.
+     *            Os valores de 'other' são movidos para nós desta lista
+     *            (o vetor é reservado antes) e 'other' fica vazia.
+     *---------------------------------------------------------------*/
+    template <typename Compare>
+    void merge(CompactDoublyLinkedList& other, Compare comp) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Merge);
+        typename Instrumentation::Scope otherScope(other.metrics, ListOperation::Merge);
+        if (&other == this || other.size == 0)
+            return;
+        reserve(static_cast<int>(used) + other.size);
+        uint32_t first = other.head;
+        uint32_t last = other.tail;
+        int count = other.size;
+        other.unlinkRange(first, last, count);
+        adoptChain(other, first, last);
+        metrics.traversed(size + count);
+        uint32_t chain = head;
+        size += count;
+        try {
+            mergeChains(chain, first, comp);
+        } catch (...) {
+            relinkChain(chain);
+            throw;
+        }
+        relinkChain(chain);
+    }
+
+    void insertSorted(const T& value) {
+        insertSorted(value, less<T>());
+    }
+
+    void insertSorted(T&& value) {
+        insertSorted(std::move(value), less<T>());
+    }
+
+    template <typename Compare>
+    void insertSorted(const T& value, Compare comp) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::InsertSorted);
+        uint32_t refSlot = upperBound(value, comp);
+        linkSlotBefore(createSlot(value), refSlot);
+    }
+
+    template <typename Compare>
+    void insertSorted(T&& value, Compare comp) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::InsertSorted);
+        uint32_t refSlot = upperBound(value, comp);
+        linkSlotBefore(createSlot(std::move(value)), refSlot);
+    }
+
+    int unique() {
+        return unique(equal_to<T>());
+    }
+
+    template <typename BinaryPredicate>
+    int unique(BinaryPredicate equal) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Unique);
+        metrics.traversed(size);
+        int removed = 0;
+        uint32_t kept = head;
+        while (kept != Null && slots[kept].next != Null) {
+            uint32_t current = slots[kept].next;
+            if (equal(valueAt(kept), valueAt(current))) {
+                removeSlot(current);
+                removed++;
+            } else {
+                kept = current;
+            }
+        }
+        return removed;
+    }
+
+    int length() const {
+        return size;
+    }
+
+    Instrumentation& instrumentation() {
+        return metrics;
+    }
+
+    const Instrumentation& instrumentation() const {
+        return metrics;
+    }
+
+    void print(int index) const {
+        try {
+            T value = get(index);
+            cout << "Elemento no índice " << index << ": " << value << endl;
+        } catch (const exception& e) {
+            cout << "Erro ao imprimir: " << e.what() << endl;
+        }
+    }
+
+    void printAll() const {
+        if (head == Null) {
+            cout << "Lista vazia." << endl;
+            return;
+        }
+        cout << "Elementos da lista: ";
+        for (uint32_t current = head; current != Null; current = slots[current].next) {
+            cout << valueAt(current);
+            if (slots[current].next != Null)
+                cout << " -> ";
+        }
+        cout << endl;
+    }
+
+    iterator begin() { return iterator(head, this); }
+    iterator end() { return iterator(Null, this); }
+    const_iterator begin() const { return const_iterator(head, this); }
+    const_iterator end() const { return const_iterator(Null, this); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Insert);
+        uint32_t index = createSlot(std::forward<Args>(args)...);
+        linkSlotBefore(index, pos.index);
+        return iterator(index, this);
+    }
+
+    iterator erase(const_iterator pos) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Erase);
+        if (pos.index == Null)
+            throw runtime_error("Operação inválida: nó nulo.");
+        uint32_t next = slots[pos.index].next;
+        removeSlot(pos.index);
+        return iterator(next, this);
+    }
+};
+
+template <typename T, typename Instrumentation>
+const uint32_t CompactDoublyLinkedList<T, Instrumentation>::Null;
+
+template <typename T, typename Instrumentation>
+const uint32_t CompactDoublyLinkedList<T, Instrumentation>::FreeSlot;
+
+/*---------------------------------------------------------------
+ * Função template deslocate() (lista compacta)
+ * Descrição: Desloca o elemento do índice 'index' da lista 'source'
+ *            para a posição 'newIndex' na lista 'dest'. Dentro da mesma
+ *            lista o nó é religado; entre listas o valor é movido para
+ *            um nó do vetor de destino.
+ *---------------------------------------------------------------*/
+template <typename T, typename Instrumentation>
+void deslocate(CompactDoublyLinkedList<T, Instrumentation>& source, CompactDoublyLinkedList<T, Instrumentation>& dest,
+               int index, int newIndex) {
+    typename Instrumentation::Scope sourceScope(source.metrics, ListOperation::Deslocate);
+    typename Instrumentation::Scope destScope(dest.metrics, ListOperation::Deslocate);
+    uint32_t slot = source.getSlotAt(index);
+    int destSize = (&source == &dest) ? dest.size - 1 : dest.size;
+    if (newIndex < 0 || newIndex > destSize)
+        throw out_of_range("Índice fora dos limites da lista.");
+    if (&source == &dest) {
+        source.unlinkSlot(slot);
+        dest.insertSlotAt(slot, newIndex);
+        return;
+    }
+    uint32_t refSlot = (newIndex == dest.size) ? dest.Null : dest.getSlotAt(newIndex);
+    uint32_t moved = dest.createSlot(std::move(source.valueAt(slot)));
+    source.removeSlot(slot);
+    dest.linkSlotBefore(moved, refSlot);
+}
+
+/*---------------------------------------------------------------
+ * Função template splice() (lista compacta)
+ * Descrição: Move os elementos das posições [first, last) da lista
+ *            'source' para antes da posição 'pos' da lista 'dest' (mesma
+ *            semântica do splice da DoublyLinkedList). Dentro da mesma
+ *            lista o intervalo é religado de uma vez; entre listas os
+ *            valores são movidos para nós do vetor de destino.
+ *---------------------------------------------------------------*/
+template <typename T, typename Instrumentation>
+void splice(CompactDoublyLinkedList<T, Instrumentation>& dest, int pos,
+            CompactDoublyLinkedList<T, Instrumentation>& source, int first, int last) {
+    typename Instrumentation::Scope destScope(dest.metrics, ListOperation::Splice);
+    typename Instrumentation::Scope sourceScope(source.metrics, ListOperation::Splice);
+    if (first < 0 || last > source.size || first > last)
+        throw out_of_range("Intervalo fora dos limites da lista.");
+    if (pos < 0 || pos > dest.size)
+        throw out_of_range("Índice fora dos limites da lista.");
+    bool sameList = (&source == &dest);
+    if (sameList && pos > first && pos < last)
+        throw invalid_argument("Posição de destino dentro do intervalo a ser movido.");
+    int count = last - first;
+    if (count == 0 || (sameList && (pos == first || pos == last)))
+        return; // Sem alteração
+    if (!sameList)
+        dest.reserve(static_cast<int>(dest.used) + count);
+    uint32_t refSlot = (pos == dest.size) ? dest.Null : dest.getSlotAt(pos);
+    uint32_t firstSlot = source.getSlotAt(first);
+    uint32_t lastSlot = source.getSlotAt(last - 1);
+    source.unlinkRange(firstSlot, lastSlot, count);
+    if (!sameList)
+        dest.adoptChain(source, firstSlot, lastSlot);
+    dest.linkRangeBefore(firstSlot, lastSlot, count, refSlot);
+}
+
+#endif // COMPACT_DOUBLY_LINKED_LIST_H
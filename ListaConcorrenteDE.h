@@ -0,0 +1,486 @@
+#ifndef CONCURRENT_DOUBLY_LINKED_LIST_H
+#define CONCURRENT_DOUBLY_LINKED_LIST_H
+
+#include "ListaGenericaDE.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/*
+Descrição:
+Variante concorrente da lista duplamente encadeada, para listas
+compartilhadas entre threads. Cada nó tem o seu próprio mutex e os
+percursos usam travamento mão sobre mão (hand-over-hand): a thread
+trava o próximo nó antes de soltar o atual, de modo que operações em
+regiões disjuntas da lista (insertAt, popAt, move, ...) avançam em
+paralelo em vez de serializar em um mutex global.
+Regras de travamento (evitam deadlock):
+  - dentro de uma lista, os nós são travados sempre da esquerda para a
+    direita (do head para o tail);
+  - operações que começam pelo final (push, pop) travam o tail e usam
+    try_lock no sentido contrário, desistindo e recomeçando se falhar;
+  - deslocate entre listas diferentes trava primeiro a lista de menor
+    endereço e depois a outra (ordem fixa).
+*/
+
+/*---------------------------------------------------------------
+ * Estrutura ConcurrentLink
+ * Descrição: Parte de encadeamento comum aos nós e às sentinelas.
+ * Glossário:
+ *    - lock: mutex que protege next e prev deste nó.
+ *    - next/prev: vizinhos; alterar X->next ou X->prev exige o mutex
+ *                 de X.
+ *---------------------------------------------------------------*/
+struct ConcurrentLink {
+    mutex lock;
+    ConcurrentLink* next;
+    ConcurrentLink* prev;
+
+    ConcurrentLink() : next(nullptr), prev(nullptr) {}
+};
+
+/*---------------------------------------------------------------
+ * Template da estrutura ConcurrentNode
+ * Descrição: Nó com dado da lista concorrente.
+ *---------------------------------------------------------------*/
+template <typename T>
+struct ConcurrentNode : ConcurrentLink {
+    T data;
+
+    template <typename... Args>
+    explicit ConcurrentNode(Args&&... args) : data(std::forward<Args>(args)...) {}
+};
+
+/*---------------------------------------------------------------
+ * Classe ConcurrentDoublyLinkedList
+ * Descrição: Lista duplamente encadeada segura para threads, com
+ *            sentinelas de início e fim e travamento por nó.
+ *            Não há operator[] nem get() por referência: os valores
+ *            são copiados sob o mutex do nó.
+ *            move() e deslocate() dentro da mesma lista são feitos em
+ *            duas etapas (retirada e reinserção); entre as etapas o nó
+ *            não é visível para as outras threads.
+ *---------------------------------------------------------------*/
+template <typename T>
+class ConcurrentDoublyLinkedList {
+private:
+    typedef ConcurrentNode<T> Node;
+
+    // Janela de nós travados em torno de uma posição: pred e succ sempre;
+    // node apenas nas remoções.
+    struct Window {
+        ConcurrentLink* pred;
+        ConcurrentLink* node;
+        ConcurrentLink* succ;
+
+        void unlock() {
+            succ->lock.unlock();
+            if (node != nullptr)
+                node->lock.unlock();
+            pred->lock.unlock();
+        }
+    };
+
+    ConcurrentLink first;   // Sentinela de início (antes do índice 0)
+    ConcurrentLink last;    // Sentinela de fim (depois do último índice)
+    atomic<int> size;       // Número de elementos (instantâneo)
+
+    ConcurrentDoublyLinkedList(const ConcurrentDoublyLinkedList&);
+    ConcurrentDoublyLinkedList& operator=(const ConcurrentDoublyLinkedList&);
+
+    // Método auxiliar que percorre mão sobre mão até a posição index - 1
+    // (a sentinela de início para index 0) e a retorna travada.
+    // Lança exceção se a lista tiver menos de index elementos.
+    ConcurrentLink* lockPredecessor(int index) {
+        if (index < 0)
+            throw out_of_range("Índice fora dos limites da lista.");
+        first.lock.lock();
+        ConcurrentLink* current = &first;
+        for (int i = 0; i < index; i++) {
+            ConcurrentLink* next = current->next;
+            if (next == &last) {
+                current->lock.unlock();
+                throw out_of_range("Índice fora dos limites da lista.");
+            }
+            next->lock.lock();
+            current->lock.unlock();
+            current = next;
+        }
+        return current;
+    }
+
+    // Trava os vizinhos da posição de inserção index (0 a size).
+    Window lockInsertWindow(int index) {
+        Window w;
+        w.pred = lockPredecessor(index);
+        w.node = nullptr;
+        w.succ = w.pred->next;
+        w.succ->lock.lock();
+        return w;
+    }
+
+    // Trava o nó da posição index (0 a size - 1) e os seus vizinhos.
+    Window lockRemoveWindow(int index) {
+        Window w;
+        w.pred = lockPredecessor(index);
+        w.node = w.pred->next;
+        if (w.node == &last) {
+            w.pred->lock.unlock();
+            throw out_of_range("Índice fora dos limites da lista.");
+        }
+        w.node->lock.lock();
+        w.succ = w.node->next;
+        w.succ->lock.lock();
+        return w;
+    }
+
+    // Liga node entre w.pred e w.succ (ambos travados).
+    void linkInto(const Window& w, ConcurrentLink* node) {
+        node->prev = w.pred;
+        node->next = w.succ;
+        w.pred->next = node;
+        w.succ->prev = node;
+        size.fetch_add(1);
+    }
+
+    // Desliga w.node (travado junto com os vizinhos).
+    void unlinkFrom(const Window& w) {
+        w.pred->next = w.succ;
+        w.succ->prev = w.pred;
+        size.fetch_sub(1);
+    }
+
+    // Remove o nó da posição index e o devolve desligado (sem liberar).
+    Node* detachAt(int index) {
+        Window w = lockRemoveWindow(index);
+        unlinkFrom(w);
+        w.unlock();
+        return static_cast<Node*>(w.node);
+    }
+
+    // Insere um nó já criado na posição index. Se a lista encolheu por
+    // ação de outra thread e index deixou de existir, o nó vai para o
+    // final, para nunca ser perdido.
+    void attachAt(Node* node, int index) {
+        Window w;
+        try {
+            w = lockInsertWindow(index);
+        } catch (const out_of_range&) {
+            attachLast(node);
+            return;
+        }
+        linkInto(w, node);
+        w.unlock();
+    }
+
+    // Insere um nó já criado no final: trava a sentinela de fim e tenta
+    // travar o último nó no sentido contrário (try_lock), recomeçando se
+    // outra thread estiver com ele.
+    void attachLast(Node* node) {
+        for (;;) {
+            last.lock.lock();
+            ConcurrentLink* pred = last.prev;
+            if (pred->lock.try_lock()) {
+                Window w;
+                w.pred = pred;
+                w.node = nullptr;
+                w.succ = &last;
+                linkInto(w, node);
+                w.unlock();
+                return;
+            }
+            last.lock.unlock();
+            this_thread::yield();
+        }
+    }
+
+    template <typename U>
+    friend void deslocate(ConcurrentDoublyLinkedList<U>& source, ConcurrentDoublyLinkedList<U>& dest, int index, int newIndex);
+
+public:
+    // Construtor da lista: inicializa uma lista vazia (só as sentinelas).
+    ConcurrentDoublyLinkedList() : size(0) {
+        first.next = &last;
+        last.prev = &first;
+    }
+
+    // Destrutor: não pode haver outras threads usando a lista.
+    ~ConcurrentDoublyLinkedList() {
+        ConcurrentLink* current = first.next;
+        while (current != &last) {
+            ConcurrentLink* next = current->next;
+            delete static_cast<Node*>(current);
+            current = next;
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Funções push() e pushFirst()
+     * Descrição: Inserem um novo elemento no final / no início.
+     *---------------------------------------------------------------*/
+    void push(const T& value) {
+        attachLast(new Node(value));
+    }
+
+    void pushFirst(const T& value) {
+        Node* node = new Node(value);
+        Window w = lockInsertWindow(0);
+        linkInto(w, node);
+        w.unlock();
+    }
+
+    /*---------------------------------------------------------------
+     * Função insertAt()
+     * Descrição: Insere um novo elemento na posição especificada.
+     *            Trava apenas os dois vizinhos da posição.
+     *---------------------------------------------------------------*/
+    void insertAt(int index, const T& value) {
+        Window w = lockInsertWindow(index);
+        Node* node;
+        try {
+            node = new Node(value);
+        } catch (...) {
+            w.unlock();
+            throw;
+        }
+        linkInto(w, node);
+        w.unlock();
+    }
+
+    /*---------------------------------------------------------------
+     * Função pop()
+     * Descrição: Remove o último elemento da lista.
+     *---------------------------------------------------------------*/
+    void pop() {
+        for (;;) {
+            last.lock.lock();
+            ConcurrentLink* victim = last.prev;
+            if (victim == &first) {
+                last.lock.unlock();
+                throw underflow_error("Lista vazia. Não há elementos para remover.");
+            }
+            // Sentido contrário: apenas try_lock, recomeçando se falhar
+            if (victim->lock.try_lock()) {
+                ConcurrentLink* pred = victim->prev;
+                if (pred->lock.try_lock()) {
+                    Window w;
+                    w.pred = pred;
+                    w.node = victim;
+                    w.succ = &last;
+                    unlinkFrom(w);
+                    w.unlock();
+                    delete static_cast<Node*>(victim);
+                    return;
+                }
+                victim->lock.unlock();
+            }
+            last.lock.unlock();
+            this_thread::yield();
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Função popFirst()
+     * Descrição: Remove o primeiro elemento da lista.
+     *---------------------------------------------------------------*/
+    void popFirst() {
+        Window w;
+        try {
+            w = lockRemoveWindow(0);
+        } catch (const out_of_range&) {
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        }
+        unlinkFrom(w);
+        w.unlock();
+        delete static_cast<Node*>(w.node);
+    }
+
+    /*---------------------------------------------------------------
+     * Função popByValue()
+     * Descrição: Remove o primeiro nó que contenha o valor especificado.
+     *---------------------------------------------------------------*/
+    void popByValue(const T& value) {
+        first.lock.lock();
+        ConcurrentLink* pred = &first;
+        ConcurrentLink* current = first.next;
+        current->lock.lock();
+        while (current != &last) {
+            if (static_cast<Node*>(current)->data == value) {
+                Window w;
+                w.pred = pred;
+                w.node = current;
+                w.succ = current->next;
+                w.succ->lock.lock();
+                unlinkFrom(w);
+                w.unlock();
+                delete static_cast<Node*>(current);
+                return;
+            }
+            ConcurrentLink* next = current->next;
+            next->lock.lock();
+            pred->lock.unlock();
+            pred = current;
+            current = next;
+        }
+        current->lock.unlock();
+        pred->lock.unlock();
+        throw runtime_error("Valor não encontrado na lista.");
+    }
+
+    /*---------------------------------------------------------------
+     * Função popAt()
+     * Descrição: Remove o nó na posição especificada e retorna seu valor.
+     *---------------------------------------------------------------*/
+    T popAt(int index) {
+        Node* node = detachAt(index);
+        T value(std::move(node->data));
+        delete node;
+        return value;
+    }
+
+    /*---------------------------------------------------------------
+     * Função move()
+     * Descrição: Move o nó da posição 'index' para a nova posição
+     *            'newIndex' (mesma semântica da DoublyLinkedList::move).
+     *            O nó é retirado e reinserido sem nova alocação.
+     *---------------------------------------------------------------*/
+    void move(int index, int newIndex) {
+        int current = size.load();
+        if (index < 0 || index >= current)
+            throw out_of_range("Índice original fora dos limites da lista.");
+        if (newIndex < 0 || newIndex > current - 1)
+            throw out_of_range("Novo índice fora dos limites da lista.");
+        if (index == newIndex)
+            return; // Sem alteração
+        Node* movingNode = detachAt(index);
+        // Se o nó removido estava antes da nova posição, ajusta newIndex
+        if (index < newIndex)
+            newIndex--;
+        attachAt(movingNode, newIndex);
+    }
+
+    /*---------------------------------------------------------------
+     * Funções get() e set()
+     * Descrição: Leem (por cópia) ou alteram o elemento na posição
+     *            especificada sob o mutex do nó.
+     *---------------------------------------------------------------*/
+    T get(int index) {
+        ConcurrentLink* pred = lockPredecessor(index);
+        ConcurrentLink* node = pred->next;
+        if (node == &last) {
+            pred->lock.unlock();
+            throw out_of_range("Índice fora dos limites da lista.");
+        }
+        node->lock.lock();
+        pred->lock.unlock();
+        lock_guard<mutex> guard(node->lock, adopt_lock);
+        return static_cast<Node*>(node)->data;
+    }
+
+    void set(int index, const T& value) {
+        ConcurrentLink* pred = lockPredecessor(index);
+        ConcurrentLink* node = pred->next;
+        if (node == &last) {
+            pred->lock.unlock();
+            throw out_of_range("Índice fora dos limites da lista.");
+        }
+        node->lock.lock();
+        pred->lock.unlock();
+        lock_guard<mutex> guard(node->lock, adopt_lock);
+        static_cast<Node*>(node)->data = value;
+    }
+
+    /*---------------------------------------------------------------
+     * Função length()
+     * Descrição: Retorna o número de elementos no instante da chamada.
+     *---------------------------------------------------------------*/
+    int length() const {
+        return size.load();
+    }
+
+    /*---------------------------------------------------------------
+     * Função printAll()
+     * Descrição: Imprime todos os elementos, percorrendo mão sobre mão.
+     *---------------------------------------------------------------*/
+    void printAll() {
+        first.lock.lock();
+        ConcurrentLink* current = &first;
+        if (current->next == &last) {
+            current->lock.unlock();
+            cout << "Lista vazia." << endl;
+            return;
+        }
+        cout << "Elementos da lista: ";
+        for (;;) {
+            ConcurrentLink* next = current->next;
+            next->lock.lock();
+            current->lock.unlock();
+            current = next;
+            if (current == &last)
+                break;
+            cout << static_cast<Node*>(current)->data;
+            if (current->next != &last)
+                cout << " -> ";
+        }
+        current->lock.unlock();
+        cout << endl;
+    }
+};
+
+/*---------------------------------------------------------------
+ * Função template deslocate() (lista concorrente)
+ * Descrição: Desloca o nó do índice 'index' da lista 'source' para a
+ *            posição 'newIndex' na lista 'dest'.
+ *            Entre listas diferentes a operação é atômica: as janelas
+ *            das duas posições ficam travadas ao mesmo tempo, sempre
+ *            travando primeiro a lista de menor endereço, o que impede
+ *            deadlock entre deslocates em sentidos opostos.
+ *            Na mesma lista, equivale a retirar e reinserir o nó;
+ *            como em move(), os dois índices são validados antes e
+ *            newIndex deve estar entre 0 e length() - 1.
+ *---------------------------------------------------------------*/
+template <typename T>
+void deslocate(ConcurrentDoublyLinkedList<T>& source, ConcurrentDoublyLinkedList<T>& dest, int index, int newIndex) {
+    typedef typename ConcurrentDoublyLinkedList<T>::Window Window;
+    typedef typename ConcurrentDoublyLinkedList<T>::Node Node;
+
+    if (&source == &dest) {
+        // Mesma validação de move(): attachAt levaria um newIndex
+        // inexistente para o final em vez de lançar exceção
+        int current = source.size.load();
+        if (index < 0 || index >= current || newIndex < 0 || newIndex > current - 1)
+            throw out_of_range("Índice fora dos limites da lista.");
+        Node* node = source.detachAt(index);
+        source.attachAt(node, newIndex);
+        return;
+    }
+
+    Window from;
+    Window to;
+    if (less<const void*>()(&source, &dest)) {
+        from = source.lockRemoveWindow(index);
+        try {
+            to = dest.lockInsertWindow(newIndex);
+        } catch (...) {
+            from.unlock();
+            throw;
+        }
+    } else {
+        to = dest.lockInsertWindow(newIndex);
+        try {
+            from = source.lockRemoveWindow(index);
+        } catch (...) {
+            to.unlock();
+            throw;
+        }
+    }
+    source.unlinkFrom(from);
+    dest.linkInto(to, from.node);
+    to.unlock();
+    from.unlock();
+}
+
+#endif // CONCURRENT_DOUBLY_LINKED_LIST_H
@@ -0,0 +1,586 @@
+#ifndef UNROLLED_DOUBLY_LINKED_LIST_H
+#define UNROLLED_DOUBLY_LINKED_LIST_H
+
+#include "ListaGenericaDE.h"
+#include "BuscaVetorialDE.h"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+Descrição:
+Variante desenrolada (unrolled) da lista duplamente encadeada. Cada bloco
+guarda até BlockSize elementos em um vetor contíguo, o que reduz a
+quantidade de ponteiros seguidos durante os percursos e o custo de
+ponteiros por elemento aproximadamente pelo fator BlockSize.
+A interface pública segue a da DoublyLinkedList (push, pushFirst,
+insertAt, push(refValue, side), push(index, value, side), pop, popFirst,
+popByValue, popByValue(value, side), pop(index, side), popAt, move,
+operator[], get, set, deslocate, ...).
+As buscas por valor (popByValue, indexOf, count) comparam o vetor de
+cada bloco de uma vez; para int, float e double com instruções SIMD
+(BuscaVetorialDE.h).
+*/
+
+/*---------------------------------------------------------------
+ * Template da estrutura UnrolledBlock
+ * Descrição: Bloco da lista desenrolada. Os elementos ocupam as
+ *            posições [0, count) de um armazenamento contíguo.
+ * Glossário:
+ *    - items: armazenamento bruto para até BlockSize elementos.
+ *    - count: quantidade de elementos construídos no bloco.
+ *    - next: ponteiro para o próximo bloco da lista.
+ *    - prev: ponteiro para o bloco anterior da lista.
+ *---------------------------------------------------------------*/
+template <typename T, int BlockSize>
+struct UnrolledBlock {
+    typename aligned_storage<sizeof(T), alignof(T)>::type items[BlockSize];
+    int count;
+    UnrolledBlock* next;
+    UnrolledBlock* prev;
+
+    UnrolledBlock() : count(0), next(nullptr), prev(nullptr) {}
+
+    // Destrói os elementos ainda presentes no bloco
+    ~UnrolledBlock() {
+        for (int i = 0; i < count; i++)
+            at(i).~T();
+    }
+
+    T& at(int offset) {
+        return reinterpret_cast<T*>(items)[offset];
+    }
+
+    const T& at(int offset) const {
+        return reinterpret_cast<const T*>(items)[offset];
+    }
+
+    // Elementos [0, count) como vetor contíguo
+    const T* data() const {
+        return reinterpret_cast<const T*>(items);
+    }
+
+    // Insere value (copiado ou movido) na posição offset, deslocando os
+    // seguintes para a direita. Pré-condição: count < BlockSize.
+    template <typename V>
+    void insert(int offset, V&& value) {
+        if (offset == count) {
+            new (&items[count]) T(std::forward<V>(value));
+        } else {
+            T copy(std::forward<V>(value)); // value pode referenciar um elemento do próprio bloco
+            new (&items[count]) T(std::move(at(count - 1)));
+            for (int i = count - 1; i > offset; i--)
+                at(i) = std::move(at(i - 1));
+            at(offset) = std::move(copy);
+        }
+        count++;
+    }
+
+    // Remove o elemento em offset, deslocando os seguintes para a esquerda.
+    void erase(int offset) {
+        for (int i = offset; i < count - 1; i++)
+            at(i) = std::move(at(i + 1));
+        at(count - 1).~T();
+        count--;
+    }
+
+    // Move os elementos [from, count) para o final do bloco dest.
+    void transferTail(int from, UnrolledBlock* dest) {
+        for (int i = from; i < count; i++) {
+            new (&dest->items[dest->count]) T(std::move(at(i)));
+            dest->count++;
+            at(i).~T();
+        }
+        count = from;
+    }
+};
+
+/*---------------------------------------------------------------
+ * Classe UnrolledDoublyLinkedList
+ * Descrição: Lista duplamente encadeada de blocos. Blocos cheios são
+ *            divididos ao meio na inserção; blocos que ficam com menos
+ *            da metade da capacidade são fundidos com o vizinho na
+ *            remoção.
+ * Parâmetros do template:
+ *    - T: tipo do dado armazenado.
+ *    - BlockSize: capacidade de cada bloco (definida em compilação).
+ *---------------------------------------------------------------*/
+template <typename T, int BlockSize = 16>
+class UnrolledDoublyLinkedList {
+    static_assert(BlockSize >= 2, "BlockSize deve ser no mínimo 2.");
+
+private:
+    typedef UnrolledBlock<T, BlockSize> Block;
+
+    Block* head;   // Primeiro bloco da lista
+    Block* tail;   // Último bloco da lista
+    int size;      // Número de elementos presentes na lista
+
+    UnrolledDoublyLinkedList(const UnrolledDoublyLinkedList&);
+    UnrolledDoublyLinkedList& operator=(const UnrolledDoublyLinkedList&);
+
+    // Método auxiliar para localizar o bloco que contém a posição index.
+    // Percorre bloco a bloco a partir da extremidade mais próxima e
+    // devolve em offset a posição do elemento dentro do bloco.
+    Block* locate(int index, int& offset) const {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        if (index < size / 2) {
+            Block* current = head;
+            while (index >= current->count) {
+                index -= current->count;
+                current = current->next;
+            }
+            offset = index;
+            return current;
+        }
+        Block* current = tail;
+        int remaining = size - 1 - index; // Distância a partir do final
+        while (remaining >= current->count) {
+            remaining -= current->count;
+            current = current->prev;
+        }
+        offset = current->count - 1 - remaining;
+        return current;
+    }
+
+    // Método auxiliar para buscar a primeira ocorrência de value.
+    // Compara o vetor de cada bloco de uma vez (ValueSearch) e devolve o
+    // bloco (nullptr se não encontrar), a posição no bloco e o índice.
+    Block* findValue(const T& value, int& offset, int& index) const {
+        index = 0;
+        for (Block* block = head; block != nullptr; block = block->next) {
+            offset = ValueSearch<T>::find(block->data(), block->count, value);
+            if (offset >= 0) {
+                index += offset;
+                return block;
+            }
+            index += block->count;
+        }
+        return nullptr;
+    }
+
+    // Método auxiliar para criar um bloco vazio logo após 'after'
+    // (ou no início da lista, se after for nullptr).
+    Block* insertBlockAfter(Block* after) {
+        Block* block = new Block;
+        block->prev = after;
+        block->next = (after != nullptr) ? after->next : head;
+        if (block->next != nullptr)
+            block->next->prev = block;
+        else
+            tail = block;
+        if (after != nullptr)
+            after->next = block;
+        else
+            head = block;
+        return block;
+    }
+
+    // Método auxiliar para desanexar e liberar um bloco.
+    void removeBlock(Block* block) {
+        if (block->prev != nullptr)
+            block->prev->next = block->next;
+        else
+            head = block->next;
+        if (block->next != nullptr)
+            block->next->prev = block->prev;
+        else
+            tail = block->prev;
+        delete block;
+    }
+
+    // Método auxiliar para remover o elemento (block, offset), liberando
+    // o bloco vazio ou fundindo-o com o vizinho quando ficar esparso.
+    void eraseAt(Block* block, int offset) {
+        block->erase(offset);
+        size--;
+        if (block->count == 0) {
+            removeBlock(block);
+            return;
+        }
+        if (block->count < BlockSize / 2) {
+            if (block->next != nullptr && block->count + block->next->count <= BlockSize) {
+                block->next->transferTail(0, block);
+                removeBlock(block->next);
+            } else if (block->prev != nullptr && block->prev->count + block->count <= BlockSize) {
+                block->transferTail(0, block->prev);
+                removeBlock(block);
+            }
+        }
+    }
+
+    // Métodos auxiliares de inserção, compartilhados pelas versões que
+    // copiam (const T&) e que movem (T&&) o valor.
+    template <typename V>
+    void appendValue(V&& value) {
+        if (tail == nullptr || tail->count == BlockSize)
+            insertBlockAfter(tail);
+        tail->insert(tail->count, std::forward<V>(value));
+        size++;
+    }
+
+    template <typename V>
+    void prependValue(V&& value) {
+        if (head == nullptr || head->count == BlockSize)
+            insertBlockAfter(nullptr);
+        head->insert(0, std::forward<V>(value));
+        size++;
+    }
+
+    template <typename V>
+    void insertValueAt(int index, V&& value) {
+        if (index < 0 || index > size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        if (index == size) {
+            appendValue(std::forward<V>(value));
+            return;
+        }
+        int offset;
+        Block* block = locate(index, offset);
+        if (block->count == BlockSize) {
+            // Divide o bloco: a metade superior vai para um bloco novo.
+            // O valor é construído antes da divisão, pois pode referenciar
+            // um elemento que muda de bloco.
+            Block* sibling = insertBlockAfter(block);
+            T copy(std::forward<V>(value));
+            block->transferTail(BlockSize / 2, sibling);
+            if (offset > block->count) {
+                offset -= block->count;
+                block = sibling;
+            }
+            block->insert(offset, std::move(copy));
+        } else {
+            block->insert(offset, std::forward<V>(value));
+        }
+        size++;
+    }
+
+    // Método auxiliar para inserir value à direita ('d') ou à esquerda
+    // ('r') da posição index.
+    void insertBeside(int index, const T& value, char side) {
+        if (side == 'd')
+            insertValueAt(index + 1, value);
+        else if (side == 'r')
+            insertValueAt(index, value);
+        else
+            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
+    }
+
+    // Método auxiliar para remover o elemento à direita ('d') ou à
+    // esquerda ('r') de (block, offset), sem percorrer a lista de novo.
+    void eraseBeside(Block* block, int offset, char side) {
+        if (side == 'd') {
+            if (offset + 1 < block->count)
+                eraseAt(block, offset + 1);
+            else if (block->next != nullptr)
+                eraseAt(block->next, 0);
+            else
+                throw runtime_error("Não há nó à direita para remover.");
+        } else if (side == 'r') {
+            if (offset > 0)
+                eraseAt(block, offset - 1);
+            else if (block->prev != nullptr)
+                eraseAt(block->prev, block->prev->count - 1);
+            else
+                throw runtime_error("Não há nó à esquerda para remover.");
+        } else {
+            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
+        }
+    }
+
+public:
+    // Construtor da lista: inicializa uma lista vazia.
+    UnrolledDoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+
+    // Destrutor: libera todos os blocos (e os elementos que contêm).
+    ~UnrolledDoublyLinkedList() {
+        while (head != nullptr) {
+            Block* next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Função push()
+     * Descrição: Insere um novo elemento no final da lista.
+     *---------------------------------------------------------------*/
+    void push(const T& value) {
+        appendValue(value);
+    }
+
+    void push(T&& value) {
+        appendValue(std::move(value));
+    }
+
+    /*---------------------------------------------------------------
+     * Função pushFirst()
+     * Descrição: Insere um novo elemento no início da lista.
+     *---------------------------------------------------------------*/
+    void pushFirst(const T& value) {
+        prependValue(value);
+    }
+
+    void pushFirst(T&& value) {
+        prependValue(std::move(value));
+    }
+
+    /*---------------------------------------------------------------
+     * Função push(refValue, side)
+     * Descrição: Insere uma cópia de refValue à direita ('d') ou à
+     *            esquerda ('r') da primeira ocorrência de refValue.
+     *---------------------------------------------------------------*/
+    void push(const T& refValue, char side) {
+        int offset, index;
+        if (findValue(refValue, offset, index) == nullptr)
+            throw runtime_error("Valor de referência não encontrado na lista.");
+        insertBeside(index, refValue, side);
+    }
+
+    /*---------------------------------------------------------------
+     * Função push(index, value, side)
+     * Descrição: Insere 'value' à direita ('d') ou à esquerda ('r') do
+     *            elemento na posição index.
+     *---------------------------------------------------------------*/
+    void push(int index, const T& value, char side) {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        insertBeside(index, value, side);
+    }
+
+    /*---------------------------------------------------------------
+     * Função insertAt()
+     * Descrição: Insere um novo elemento na posição especificada.
+     *            Se o bloco de destino estiver cheio, ele é dividido
+     *            ao meio antes da inserção.
+     * Parâmetro:
+     *    - index: posição onde inserir (0 para início, size para final).
+     *    - value: valor a ser inserido.
+     *---------------------------------------------------------------*/
+    void insertAt(int index, const T& value) {
+        insertValueAt(index, value);
+    }
+
+    void insertAt(int index, T&& value) {
+        insertValueAt(index, std::move(value));
+    }
+
+    /*---------------------------------------------------------------
+     * Função pop()
+     * Descrição: Remove o último elemento da lista.
+     *---------------------------------------------------------------*/
+    void pop() {
+        if (size == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        eraseAt(tail, tail->count - 1);
+    }
+
+    /*---------------------------------------------------------------
+     * Função popFirst()
+     * Descrição: Remove o primeiro elemento da lista.
+     *---------------------------------------------------------------*/
+    void popFirst() {
+        if (size == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        eraseAt(head, 0);
+    }
+
+    /*---------------------------------------------------------------
+     * Função popByValue()
+     * Descrição: Remove o primeiro elemento igual ao valor especificado.
+     *---------------------------------------------------------------*/
+    void popByValue(const T& value) {
+        int offset, index;
+        Block* block = findValue(value, offset, index);
+        if (block == nullptr)
+            throw runtime_error("Valor não encontrado na lista.");
+        eraseAt(block, offset);
+    }
+
+    /*---------------------------------------------------------------
+     * Função popByValue(value, side)
+     * Descrição: Remove o elemento à direita ('d') ou à esquerda ('r')
+     *            da primeira ocorrência de value.
+     *---------------------------------------------------------------*/
+    void popByValue(const T& value, char side) {
+        int offset, index;
+        Block* block = findValue(value, offset, index);
+        if (block == nullptr)
+            throw runtime_error("Valor de referência não encontrado na lista.");
+        eraseBeside(block, offset, side);
+    }
+
+    /*---------------------------------------------------------------
+     * Função pop(index, side)
+     * Descrição: Remove o elemento à direita ('d') ou à esquerda ('r')
+     *            do elemento na posição index.
+     *---------------------------------------------------------------*/
+    void pop(int index, char side) {
+        if (size < 2)
+            throw runtime_error("Não é possível remover nó adjacente em uma lista com um único elemento.");
+        int offset;
+        Block* block = locate(index, offset);
+        eraseBeside(block, offset, side);
+    }
+
+    /*---------------------------------------------------------------
+     * Função indexOf()
+     * Descrição: Retorna o índice da primeira ocorrência de 'value', ou
+     *            -1 se o valor não estiver na lista.
+     *---------------------------------------------------------------*/
+    int indexOf(const T& value) const {
+        int offset, index;
+        return (findValue(value, offset, index) != nullptr) ? index : -1;
+    }
+
+    /*---------------------------------------------------------------
+     * Função count()
+     * Descrição: Retorna a quantidade de elementos iguais a 'value'.
+     *---------------------------------------------------------------*/
+    int count(const T& value) const {
+        int total = 0;
+        for (Block* block = head; block != nullptr; block = block->next)
+            total += ValueSearch<T>::count(block->data(), block->count, value);
+        return total;
+    }
+
+    /*---------------------------------------------------------------
+     * Função popAt()
+     * Descrição: Remove o elemento na posição especificada e retorna
+     *            seu valor.
+     *---------------------------------------------------------------*/
+    T popAt(int index) {
+        int offset;
+        Block* block = locate(index, offset);
+        T value(std::move(block->at(offset)));
+        eraseAt(block, offset);
+        return value;
+    }
+
+    /*---------------------------------------------------------------
+     * Função move()
+     * Descrição: Move o elemento da posição 'index' para a nova posição
+     *            'newIndex' dentro da mesma lista (mesma semântica da
+     *            DoublyLinkedList::move).
+     *---------------------------------------------------------------*/
+    void move(int index, int newIndex) {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice original fora dos limites da lista.");
+        if (newIndex < 0 || newIndex > size - 1)
+            throw out_of_range("Novo índice fora dos limites da lista.");
+        if (index == newIndex)
+            return; // Sem alteração
+        T value = popAt(index);
+        // Se o elemento removido estava antes da nova posição, ajusta newIndex
+        if (index < newIndex)
+            newIndex--;
+        insertAt(newIndex, std::move(value));
+    }
+
+    /*---------------------------------------------------------------
+     * Operador []
+     * Descrição: Permite acesso ao elemento pelo índice, para leitura
+     *            e escrita.
+     *---------------------------------------------------------------*/
+    T& operator[](int index) {
+        return get(index);
+    }
+
+    const T& operator[](int index) const {
+        return get(index);
+    }
+
+    /*---------------------------------------------------------------
+     * Função get()
+     * Descrição: Retorna uma referência ao elemento na posição
+     *            especificada (somente leitura na versão const).
+     *---------------------------------------------------------------*/
+    T& get(int index) {
+        int offset;
+        Block* block = locate(index, offset);
+        return block->at(offset);
+    }
+
+    const T& get(int index) const {
+        int offset;
+        Block* block = locate(index, offset);
+        return block->at(offset);
+    }
+
+    /*---------------------------------------------------------------
+     * Função set()
+     * Descrição: Define o valor do elemento na posição especificada.
+     *---------------------------------------------------------------*/
+    void set(int index, const T& value) {
+        int offset;
+        Block* block = locate(index, offset);
+        block->at(offset) = value;
+    }
+
+    /*---------------------------------------------------------------
+     * Função length()
+     * Descrição: Retorna o número de elementos presentes na lista.
+     *---------------------------------------------------------------*/
+    int length() const {
+        return size;
+    }
+
+    /*---------------------------------------------------------------
+     * Função print()
+     * Descrição: Imprime o elemento na posição especificada.
+     *---------------------------------------------------------------*/
+    void print(int index) const {
+        try {
+            cout << "Elemento no índice " << index << ": " << get(index) << endl;
+        } catch (const exception& e) {
+            cout << "Erro ao imprimir: " << e.what() << endl;
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Função printAll()
+     * Descrição: Imprime todos os elementos da lista, bloco a bloco.
+     *---------------------------------------------------------------*/
+    void printAll() const {
+        if (size == 0) {
+            cout << "Lista vazia." << endl;
+            return;
+        }
+        cout << "Elementos da lista: ";
+        bool first = true;
+        for (Block* block = head; block != nullptr; block = block->next) {
+            for (int i = 0; i < block->count; i++) {
+                if (!first)
+                    cout << " -> ";
+                cout << block->at(i);
+                first = false;
+            }
+        }
+        cout << endl;
+    }
+};
+
+/*---------------------------------------------------------------
+ * Função template deslocate() (lista desenrolada)
+ * Descrição: Desloca o elemento do índice 'index' da lista 'source'
+ *            para a posição 'newIndex' na lista 'dest'. O valor é
+ *            movido (nunca copiado); se a inserção em 'dest' falhar, ele
+ *            volta para a posição de origem.
+ *---------------------------------------------------------------*/
+template <typename T, int BlockSize>
+void deslocate(UnrolledDoublyLinkedList<T, BlockSize>& source, UnrolledDoublyLinkedList<T, BlockSize>& dest, int index, int newIndex) {
+    // Valida o destino antes de remover, para não perder o elemento
+    if (newIndex < 0 || newIndex > dest.length() - (&source == &dest ? 1 : 0))
+        throw out_of_range("Índice fora dos limites da lista.");
+    T data = source.popAt(index);
+    try {
+        dest.insertAt(newIndex, std::move(data));
+    } catch (...) {
+        source.insertAt(index, std::move(data));
+        throw;
+    }
+}
+
+#endif // UNROLLED_DOUBLY_LINKED_LIST_H
@@ -0,0 +1,1125 @@
+#ifndef STATIC_DOUBLY_LINKED_LIST_H
+#define STATIC_DOUBLY_LINKED_LIST_H
+
+#include "ListaGenericaDE.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/*
+Descrição:
+Lista duplamente encadeada de capacidade fixa, para caminhos de baixa
+latência: os N nós ficam em um vetor dentro do próprio objeto (sem
+nenhuma alocação no heap) e se ligam por índices; posições liberadas
+voltam para uma free-list embutida no vetor.
+Cada operação que pode falhar tem uma variante try_ que não lança
+exceção e retorna um ListStatus (lista cheia, vazia, índice fora dos
+limites, ...). As versões sem try_ mantêm a interface e as exceções da
+DoublyLinkedList (e lançam length_error quando a lista está cheia).
+Como os nós não podem passar de um vetor para outro, merge, splice e
+deslocate entre listas diferentes movem os valores para posições livres
+do destino, e emplace* constrói o valor e o move para a posição.
+Com C++14 ou superior os métodos são constexpr: a lista pode ser
+montada e alterada em tempo de compilação quando T é um tipo literal.
+T precisa de construtor padrão: as posições livres guardam T().
+*/
+
+#if __cplusplus >= 201402L
+#define LISTA_CONSTEXPR14 constexpr
+#else
+#define LISTA_CONSTEXPR14
+#endif
+
+/*---------------------------------------------------------------
+ * Enumeração ListStatus
+ * Descrição: Resultado das variantes try_ da lista estática.
+ *---------------------------------------------------------------*/
+enum ListStatus {
+    ListOk = 0,
+    ListFull,           // Sem posições livres
+    ListEmpty,          // Nenhum elemento para remover
+    ListOutOfRange,     // Índice fora dos limites
+    ListNotFound,       // Valor (ou vizinho) inexistente
+    ListInvalidSide     // Parâmetro 'side' diferente de 'd' e 'r'
+};
+
+inline const char* listStatusName(ListStatus status) {
+    static const char* const names[] = {"ok", "cheia", "vazia", "fora dos limites", "não encontrado", "lado inválido"};
+    return names[status];
+}
+
+/*---------------------------------------------------------------
+ * Template da estrutura StaticSlot
+ * Descrição: Posição do vetor de nós da lista estática.
+ * Glossário:
+ *    - data: dado (T() quando a posição está livre).
+ *    - next: próximo nó (ou próxima posição livre, na free-list).
+ *    - prev: nó anterior.
+ *---------------------------------------------------------------*/
+template <typename T, typename Index>
+struct StaticSlot {
+    T data;
+    Index next;
+    Index prev;
+
+    constexpr StaticSlot() : data(), next(0), prev(0) {}
+};
+
+/*---------------------------------------------------------------
+ * Classe StaticDoublyLinkedList
+ * Descrição: Lista duplamente encadeada com até N elementos em um
+ *            vetor embutido. Os índices usam o menor tipo sem sinal
+ *            que comporta N.
+ * Parâmetros do template:
+ *    - T: tipo do dado armazenado.
+ *    - N: capacidade máxima.
+ *---------------------------------------------------------------*/
+template <typename T, size_t N>
+class StaticDoublyLinkedList {
+    static_assert(N > 0 && N < 0xFFFFFFFFu, "Capacidade da lista estática deve estar entre 1 e 2^32 - 2.");
+    static_assert(is_default_constructible<T>::value, "StaticDoublyLinkedList exige T com construtor padrão.");
+
+public:
+    typedef typename conditional<(N < 0xFFu), uint8_t,
+            typename conditional<(N < 0xFFFFu), uint16_t, uint32_t>::type>::type Index;
+
+private:
+    typedef StaticSlot<T, Index> Slot;
+
+    static const Index Null = static_cast<Index>(N); // Ausência de nó
+
+    Slot slots[N];      // Vetor de nós
+    Index head;         // Primeiro nó da lista
+    Index tail;         // Último nó da lista
+    Index freeList;     // Primeira posição livre para reuso
+    Index used;         // Posições [0, used) já entregues alguma vez
+    int size;           // Número de elementos presentes na lista
+
+    template <typename U, size_t A, size_t B>
+    friend LISTA_CONSTEXPR14 ListStatus try_deslocate(StaticDoublyLinkedList<U, A>& source,
+                                                      StaticDoublyLinkedList<U, B>& dest, int index, int newIndex);
+    template <typename U, size_t A, size_t B>
+    friend LISTA_CONSTEXPR14 ListStatus try_splice(StaticDoublyLinkedList<U, A>& dest, int pos,
+                                                   StaticDoublyLinkedList<U, B>& source, int first, int last);
+    template <typename U, size_t A>
+    friend class StaticDoublyLinkedList;
+
+    // Método auxiliar para lançar a exceção correspondente a status,
+    // com as mensagens da DoublyLinkedList.
+    static void raise(ListStatus status) {
+        switch (status) {
+        case ListFull:
+            throw length_error("Lista estática cheia.");
+        case ListEmpty:
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        case ListOutOfRange:
+            throw out_of_range("Índice fora dos limites da lista.");
+        case ListNotFound:
+            throw runtime_error("Valor não encontrado na lista.");
+        case ListInvalidSide:
+            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
+        default:
+            break;
+        }
+    }
+
+    static LISTA_CONSTEXPR14 void check(ListStatus status) {
+        if (status != ListOk)
+            raise(status);
+    }
+
+    // Método auxiliar para obter o índice do nó na posição index,
+    // percorrendo a partir da extremidade mais próxima. Não verifica os
+    // limites.
+    LISTA_CONSTEXPR14 Index slotAt(int index) const {
+        Index current = head;
+        if (index < size / 2) {
+            for (int i = 0; i < index; i++)
+                current = slots[current].next;
+        } else {
+            current = tail;
+            for (int i = size - 1; i > index; i--)
+                current = slots[current].prev;
+        }
+        return current;
+    }
+
+    // Método auxiliar para buscar o primeiro nó com o valor especificado.
+    // Retorna Null se não encontrar.
+    LISTA_CONSTEXPR14 Index slotByValue(const T& value) const {
+        Index current = head;
+        while (current != Null && !(slots[current].data == value))
+            current = slots[current].next;
+        return current;
+    }
+
+    // Método auxiliar para reservar uma posição livre (free-list ou
+    // posição nunca usada). Retorna Null se a lista estiver cheia.
+    LISTA_CONSTEXPR14 Index acquireSlot() {
+        if (freeList != Null) {
+            Index index = freeList;
+            freeList = slots[index].next;
+            return index;
+        }
+        if (used < Null)
+            return used++;
+        return Null;
+    }
+
+    // Método auxiliar para devolver uma posição à free-list, deixando
+    // T() no lugar do dado.
+    LISTA_CONSTEXPR14 void releaseSlot(Index index) {
+        slots[index].data = T();
+        slots[index].next = freeList;
+        freeList = index;
+    }
+
+    LISTA_CONSTEXPR14 void unlinkSlot(Index index) {
+        Slot& slot = slots[index];
+        if (slot.prev != Null)
+            slots[slot.prev].next = slot.next;
+        else
+            head = slot.next;
+        if (slot.next != Null)
+            slots[slot.next].prev = slot.prev;
+        else
+            tail = slot.prev;
+        size--;
+    }
+
+    // Método auxiliar para anexar o nó index antes de refSlot (Null:
+    // ao final).
+    LISTA_CONSTEXPR14 void linkSlotBefore(Index index, Index refSlot) {
+        Slot& slot = slots[index];
+        slot.next = refSlot;
+        slot.prev = (refSlot != Null) ? slots[refSlot].prev : tail;
+        if (slot.prev != Null)
+            slots[slot.prev].next = index;
+        else
+            head = index;
+        if (refSlot != Null)
+            slots[refSlot].prev = index;
+        else
+            tail = index;
+        size++;
+    }
+
+    LISTA_CONSTEXPR14 void removeSlot(Index index) {
+        unlinkSlot(index);
+        releaseSlot(index);
+    }
+
+    // Método auxiliar para inserir value antes de refSlot.
+    template <typename V>
+    LISTA_CONSTEXPR14 ListStatus insertBefore(Index refSlot, V&& value) {
+        Index index = acquireSlot();
+        if (index == Null)
+            return ListFull;
+        slots[index].data = std::forward<V>(value);
+        linkSlotBefore(index, refSlot);
+        return ListOk;
+    }
+
+    // Método auxiliar para construir T(args...) e inseri-lo antes de
+    // refSlot. O valor é construído antes de reservar a posição (args
+    // pode referenciar um elemento da própria lista) e depois movido
+    // para ela.
+    template <typename... Args>
+    LISTA_CONSTEXPR14 ListStatus emplaceBefore(Index refSlot, Args&&... args) {
+        if (size == static_cast<int>(N))
+            return ListFull;
+        T value(std::forward<Args>(args)...);
+        return insertBefore(refSlot, std::move(value));
+    }
+
+    // Método auxiliar que retorna o nó anterior a refSlot (Null: o
+    // tail), ou seja, o nó recém-inserido antes de refSlot.
+    LISTA_CONSTEXPR14 Index slotBefore(Index refSlot) const {
+        return (refSlot == Null) ? tail : slots[refSlot].prev;
+    }
+
+    template <typename V>
+    LISTA_CONSTEXPR14 ListStatus insertValueAt(int index, V&& value) {
+        if (index < 0 || index > size)
+            return ListOutOfRange;
+        return insertBefore((index == size) ? Null : slotAt(index), std::forward<V>(value));
+    }
+
+    // Método auxiliar para inserir value à direita ('d') ou à esquerda
+    // ('r') de refSlot.
+    LISTA_CONSTEXPR14 ListStatus insertBeside(Index refSlot, const T& value, char side) {
+        if (side == 'd')
+            return insertBefore(slots[refSlot].next, value);
+        if (side == 'r')
+            return insertBefore(refSlot, value);
+        return ListInvalidSide;
+    }
+
+    // Método auxiliar para remover o nó à direita ('d') ou à esquerda
+    // ('r') de refSlot.
+    LISTA_CONSTEXPR14 ListStatus removeBeside(Index refSlot, char side) {
+        Index target = Null;
+        if (side == 'd')
+            target = slots[refSlot].next;
+        else if (side == 'r')
+            target = slots[refSlot].prev;
+        else
+            return ListInvalidSide;
+        if (target == Null)
+            return ListNotFound;
+        removeSlot(target);
+        return ListOk;
+    }
+
+    // Método auxiliar para intercalar, de forma estável, as cadeias
+    // ordenadas 'a' e 'b' (ligadas apenas por next). O resultado fica em
+    // 'a'; se comp lançar exceção, 'a' recebe todos os nós.
+    template <typename Compare>
+    void mergeChains(Index& a, Index b, Compare& comp) {
+        Index first = Null;
+        Index* link = &first;
+        try {
+            while (a != Null && b != Null) {
+                if (comp(slots[b].data, slots[a].data)) {
+                    *link = b;
+                    link = &slots[b].next;
+                    b = slots[b].next;
+                } else {
+                    *link = a;
+                    link = &slots[a].next;
+                    a = slots[a].next;
+                }
+            }
+        } catch (...) {
+            *link = a;
+            appendChain(first, b);
+            a = first;
+            throw;
+        }
+        *link = (a != Null) ? a : b;
+        a = first;
+    }
+
+    // Método auxiliar para anexar 'chain' ao final da cadeia 'first'.
+    void appendChain(Index& first, Index chain) {
+        Index* link = &first;
+        while (*link != Null)
+            link = &slots[*link].next;
+        *link = chain;
+    }
+
+    // Método auxiliar para refazer prev, head e tail a partir da cadeia
+    // 'first' ligada apenas por next.
+    LISTA_CONSTEXPR14 void relinkChain(Index first) {
+        head = first;
+        Index prev = Null;
+        for (Index current = first; current != Null; current = slots[current].next) {
+            slots[current].prev = prev;
+            prev = current;
+        }
+        tail = prev;
+    }
+
+    // Método auxiliar para desanexar a sequência de 'count' nós de first
+    // a last, mantendo-a ligada internamente.
+    LISTA_CONSTEXPR14 void unlinkRange(Index first, Index last, int count) {
+        Index before = slots[first].prev;
+        Index after = slots[last].next;
+        if (before != Null)
+            slots[before].next = after;
+        else
+            head = after;
+        if (after != Null)
+            slots[after].prev = before;
+        else
+            tail = before;
+        size -= count;
+    }
+
+    // Método auxiliar para anexar a sequência de first a last antes de
+    // refSlot (Null: ao final).
+    LISTA_CONSTEXPR14 void linkRangeBefore(Index first, Index last, int count, Index refSlot) {
+        Index before = slotBefore(refSlot);
+        slots[first].prev = before;
+        slots[last].next = refSlot;
+        if (before != Null)
+            slots[before].next = first;
+        else
+            head = first;
+        if (refSlot != Null)
+            slots[refSlot].prev = last;
+        else
+            tail = last;
+        size += count;
+    }
+
+public:
+    /*---------------------------------------------------------------
+     * Classe BasicIterator
+     * Descrição: Iterador bidirecional sobre os nós da lista.
+     *---------------------------------------------------------------*/
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        typedef bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef typename conditional<IsConst, const T*, T*>::type pointer;
+        typedef typename conditional<IsConst, const T&, T&>::type reference;
+        typedef typename conditional<IsConst, const StaticDoublyLinkedList*, StaticDoublyLinkedList*>::type ListPointer;
+
+        constexpr BasicIterator() : index(Null), list(nullptr) {}
+
+        template <bool OtherConst>
+        constexpr BasicIterator(const BasicIterator<OtherConst>& other,
+                                typename enable_if<IsConst && !OtherConst>::type* = nullptr)
+            : index(other.index), list(other.list) {}
+
+        constexpr reference operator*() const { return list->slots[index].data; }
+        constexpr pointer operator->() const { return &list->slots[index].data; }
+
+        LISTA_CONSTEXPR14 BasicIterator& operator++() {
+            index = list->slots[index].next;
+            return *this;
+        }
+
+        LISTA_CONSTEXPR14 BasicIterator operator++(int) {
+            BasicIterator copy(*this);
+            ++(*this);
+            return copy;
+        }
+
+        LISTA_CONSTEXPR14 BasicIterator& operator--() {
+            index = (index == Null) ? list->tail : list->slots[index].prev;
+            return *this;
+        }
+
+        LISTA_CONSTEXPR14 BasicIterator operator--(int) {
+            BasicIterator copy(*this);
+            --(*this);
+            return copy;
+        }
+
+        friend constexpr bool operator==(const BasicIterator& a, const BasicIterator& b) { return a.index == b.index; }
+        friend constexpr bool operator!=(const BasicIterator& a, const BasicIterator& b) { return a.index != b.index; }
+
+    private:
+        friend class StaticDoublyLinkedList;
+        template <bool> friend class BasicIterator;
+
+        Index index;        // Nó atual (Null representa end())
+        ListPointer list;   // Lista percorrida
+
+        constexpr BasicIterator(Index i, ListPointer l) : index(i), list(l) {}
+    };
+
+    typedef BasicIterator<false> iterator;
+    typedef BasicIterator<true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    // Construtor da lista: inicializa uma lista vazia.
+    constexpr StaticDoublyLinkedList()
+        : slots(), head(Null), tail(Null), freeList(Null), used(0), size(0) {}
+
+    // Construtor a partir de uma lista de inicialização: {1, 2, 3}.
+    // Lança length_error se houver mais de N valores.
+    LISTA_CONSTEXPR14 StaticDoublyLinkedList(initializer_list<T> values)
+        : slots(), head(Null), tail(Null), freeList(Null), used(0), size(0) {
+        check(try_pushRange(values.begin(), values.end()));
+    }
+
+    /*---------------------------------------------------------------
+     * Funções capacity(), length(), empty() e full()
+     *---------------------------------------------------------------*/
+    static constexpr int capacity() {
+        return static_cast<int>(N);
+    }
+
+    constexpr int length() const {
+        return size;
+    }
+
+    constexpr bool empty() const {
+        return size == 0;
+    }
+
+    constexpr bool full() const {
+        return size == static_cast<int>(N);
+    }
+
+    /*---------------------------------------------------------------
+     * Variantes try_: não lançam exceção (exceto as lançadas pelo
+     * próprio T) e retornam ListOk ou o motivo da falha. Em caso de
+     * falha a lista não é alterada.
+     *---------------------------------------------------------------*/
+    LISTA_CONSTEXPR14 ListStatus try_push(const T& value) {
+        return insertBefore(Null, value);
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_push(T&& value) {
+        return insertBefore(Null, std::move(value));
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_pushFirst(const T& value) {
+        return insertBefore(head, value);
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_pushFirst(T&& value) {
+        return insertBefore(head, std::move(value));
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_insertAt(int index, const T& value) {
+        return insertValueAt(index, value);
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_insertAt(int index, T&& value) {
+        return insertValueAt(index, std::move(value));
+    }
+
+    // Insere todos os valores de [first, last) a partir da posição index,
+    // ou nenhum se não couberem (exige iteradores de avanço; o intervalo
+    // não pode ser desta própria lista).
+    template <typename ForwardIt>
+    LISTA_CONSTEXPR14 ListStatus try_insertRange(int index, ForwardIt first, ForwardIt last) {
+        if (index < 0 || index > size)
+            return ListOutOfRange;
+        int count = 0;
+        for (ForwardIt it = first; it != last; ++it)
+            count++;
+        if (count > static_cast<int>(N) - size)
+            return ListFull;
+        // A posição é localizada uma única vez
+        Index refSlot = (index == size) ? Null : slotAt(index);
+        for (; first != last; ++first)
+            insertBefore(refSlot, *first);
+        return ListOk;
+    }
+
+    template <typename ForwardIt>
+    LISTA_CONSTEXPR14 ListStatus try_pushRange(ForwardIt first, ForwardIt last) {
+        return try_insertRange(size, first, last);
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_pop() {
+        if (size == 0)
+            return ListEmpty;
+        removeSlot(tail);
+        return ListOk;
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_popFirst() {
+        if (size == 0)
+            return ListEmpty;
+        removeSlot(head);
+        return ListOk;
+    }
+
+    // Remove o elemento da posição index, movendo o valor para 'out'.
+    LISTA_CONSTEXPR14 ListStatus try_popAt(int index, T& out) {
+        if (index < 0 || index >= size)
+            return ListOutOfRange;
+        Index slot = slotAt(index);
+        out = std::move(slots[slot].data);
+        removeSlot(slot);
+        return ListOk;
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_popByValue(const T& value) {
+        Index slot = slotByValue(value);
+        if (slot == Null)
+            return ListNotFound;
+        removeSlot(slot);
+        return ListOk;
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_move(int index, int newIndex) {
+        if (index < 0 || index >= size || newIndex < 0 || newIndex > size - 1)
+            return ListOutOfRange;
+        if (index == newIndex)
+            return ListOk; // Sem alteração
+        Index slot = slotAt(index);
+        unlinkSlot(slot);
+        // Se o nó removido estava antes da nova posição, ajusta newIndex
+        if (index < newIndex)
+            newIndex--;
+        linkSlotBefore(slot, (newIndex == size) ? Null : slotAt(newIndex));
+        return ListOk;
+    }
+
+    // Intercala a lista ordenada 'other' nesta (veja merge), ou retorna
+    // ListFull se os elementos de 'other' não couberem.
+    template <size_t M>
+    LISTA_CONSTEXPR14 ListStatus try_merge(StaticDoublyLinkedList<T, M>& other) {
+        return try_merge(other, less<T>());
+    }
+
+    template <size_t M, typename Compare>
+    LISTA_CONSTEXPR14 ListStatus try_merge(StaticDoublyLinkedList<T, M>& other, Compare comp) {
+        if (static_cast<const void*>(&other) == static_cast<const void*>(this) || other.size == 0)
+            return ListOk;
+        if (other.size > static_cast<int>(N) - size)
+            return ListFull;
+        Index current = head;
+        while (other.size > 0) {
+            T& value = other.slots[other.head].data;
+            // Em empate, os elementos desta lista vêm primeiro
+            while (current != Null && !comp(value, slots[current].data))
+                current = slots[current].next;
+            insertBefore(current, std::move(value));
+            other.removeSlot(other.head);
+        }
+        return ListOk;
+    }
+
+    // Copia o elemento da posição index para 'out'.
+    LISTA_CONSTEXPR14 ListStatus try_get(int index, T& out) const {
+        if (index < 0 || index >= size)
+            return ListOutOfRange;
+        out = slots[slotAt(index)].data;
+        return ListOk;
+    }
+
+    LISTA_CONSTEXPR14 ListStatus try_set(int index, const T& value) {
+        if (index < 0 || index >= size)
+            return ListOutOfRange;
+        slots[slotAt(index)].data = value;
+        return ListOk;
+    }
+
+    /*---------------------------------------------------------------
+     * Operações com a interface da DoublyLinkedList. Lançam as mesmas
+     * exceções e length_error quando a lista está cheia.
+     *---------------------------------------------------------------*/
+    LISTA_CONSTEXPR14 void push(const T& value) {
+        check(try_push(value));
+    }
+
+    LISTA_CONSTEXPR14 void push(T&& value) {
+        check(try_push(std::move(value)));
+    }
+
+    LISTA_CONSTEXPR14 void pushFirst(const T& value) {
+        check(try_pushFirst(value));
+    }
+
+    LISTA_CONSTEXPR14 void pushFirst(T&& value) {
+        check(try_pushFirst(std::move(value)));
+    }
+
+    LISTA_CONSTEXPR14 void insertAt(int index, const T& value) {
+        check(try_insertAt(index, value));
+    }
+
+    LISTA_CONSTEXPR14 void insertAt(int index, T&& value) {
+        check(try_insertAt(index, std::move(value)));
+    }
+
+    LISTA_CONSTEXPR14 void push(const T& refValue, char side) {
+        Index refSlot = slotByValue(refValue);
+        if (refSlot == Null)
+            throw runtime_error("Valor de referência não encontrado na lista.");
+        check(insertBeside(refSlot, refValue, side));
+    }
+
+    LISTA_CONSTEXPR14 void push(int index, const T& value, char side) {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        check(insertBeside(slotAt(index), value, side));
+    }
+
+    /*---------------------------------------------------------------
+     * Funções emplace_back(), emplace_front() e emplace_at()
+     * Descrição: Constroem T(args...) e o movem para uma posição livre
+     *            (as posições guardam sempre um T construído, por isso
+     *            não há construção direta no nó como na
+     *            DoublyLinkedList). Lançam length_error se a lista
+     *            estiver cheia.
+     * Retorno:
+     *    - referência ao elemento inserido.
+     *---------------------------------------------------------------*/
+    template <typename... Args>
+    LISTA_CONSTEXPR14 T& emplace_back(Args&&... args) {
+        check(emplaceBefore(Null, std::forward<Args>(args)...));
+        return slots[tail].data;
+    }
+
+    template <typename... Args>
+    LISTA_CONSTEXPR14 T& emplace_front(Args&&... args) {
+        check(emplaceBefore(head, std::forward<Args>(args)...));
+        return slots[head].data;
+    }
+
+    template <typename... Args>
+    LISTA_CONSTEXPR14 T& emplace_at(int index, Args&&... args) {
+        if (index < 0 || index > size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        Index refSlot = (index == size) ? Null : slotAt(index);
+        check(emplaceBefore(refSlot, std::forward<Args>(args)...));
+        return slots[slotBefore(refSlot)].data;
+    }
+
+    template <typename ForwardIt>
+    LISTA_CONSTEXPR14 int pushRange(ForwardIt first, ForwardIt last) {
+        int before = size;
+        check(try_pushRange(first, last));
+        return size - before;
+    }
+
+    // Retorna a quantidade de elementos inseridos a partir de index.
+    template <typename ForwardIt>
+    LISTA_CONSTEXPR14 int insertRange(int index, ForwardIt first, ForwardIt last) {
+        int before = size;
+        check(try_insertRange(index, first, last));
+        return size - before;
+    }
+
+    LISTA_CONSTEXPR14 void pop() {
+        check(try_pop());
+    }
+
+    LISTA_CONSTEXPR14 void popFirst() {
+        check(try_popFirst());
+    }
+
+    LISTA_CONSTEXPR14 void popByValue(const T& value) {
+        check(try_popByValue(value));
+    }
+
+    LISTA_CONSTEXPR14 void popByValue(const T& value, char side) {
+        Index refSlot = slotByValue(value);
+        if (refSlot == Null)
+            throw runtime_error("Valor de referência não encontrado na lista.");
+        ListStatus status = removeBeside(refSlot, side);
+        if (status == ListNotFound)
+            throw runtime_error(side == 'd' ? "Não há nó à direita para remover." : "Não há nó à esquerda para remover.");
+        check(status);
+    }
+
+    LISTA_CONSTEXPR14 void pop(int index, char side) {
+        if (size < 2)
+            throw runtime_error("Não é possível remover nó adjacente em uma lista com um único elemento.");
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        ListStatus status = removeBeside(slotAt(index), side);
+        if (status == ListNotFound)
+            throw runtime_error(side == 'd' ? "Não há nó à direita para remover." : "Não há nó à esquerda para remover.");
+        check(status);
+    }
+
+    LISTA_CONSTEXPR14 T popAt(int index) {
+        T value{};
+        check(try_popAt(index, value));
+        return value;
+    }
+
+    LISTA_CONSTEXPR14 void move(int index, int newIndex) {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice original fora dos limites da lista.");
+        if (newIndex < 0 || newIndex > size - 1)
+            throw out_of_range("Novo índice fora dos limites da lista.");
+        try_move(index, newIndex);
+    }
+
+    LISTA_CONSTEXPR14 T& operator[](int index) {
+        return get(index);
+    }
+
+    LISTA_CONSTEXPR14 const T& operator[](int index) const {
+        return get(index);
+    }
+
+    LISTA_CONSTEXPR14 T& get(int index) {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        return slots[slotAt(index)].data;
+    }
+
+    LISTA_CONSTEXPR14 const T& get(int index) const {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        return slots[slotAt(index)].data;
+    }
+
+    LISTA_CONSTEXPR14 void set(int index, const T& value) {
+        check(try_set(index, value));
+    }
+
+    template <typename Predicate>
+    LISTA_CONSTEXPR14 int removeIf(Predicate pred) {
+        int removed = 0;
+        Index current = head;
+        while (current != Null) {
+            Index next = slots[current].next;
+            if (pred(slots[current].data)) {
+                removeSlot(current);
+                removed++;
+            }
+            current = next;
+        }
+        return removed;
+    }
+
+    LISTA_CONSTEXPR14 int removeAll(const T& value) {
+        // Cópia: value pode ser um elemento da própria lista
+        T target(value);
+        int removed = 0;
+        Index current = head;
+        while (current != Null) {
+            Index next = slots[current].next;
+            if (slots[current].data == target) {
+                removeSlot(current);
+                removed++;
+            }
+            current = next;
+        }
+        return removed;
+    }
+
+    // Remove todos os elementos, devolvendo as posições à free-list.
+    LISTA_CONSTEXPR14 void clear() {
+        Index current = head;
+        while (current != Null) {
+            Index next = slots[current].next;
+            releaseSlot(current);
+            current = next;
+        }
+        head = Null;
+        tail = Null;
+        size = 0;
+    }
+
+    void sort() {
+        sort(less<T>());
+    }
+
+    /*---------------------------------------------------------------
+     * Função sort()
+     * Descrição: Merge sort estável de baixo para cima, religando os
+     *            índices (os valores não são movidos). Se comp lançar
+     *            exceção, a lista mantém todos os elementos.
+     *---------------------------------------------------------------*/
+    template <typename Compare>
+    void sort(Compare comp) {
+        if (size < 2)
+            return;
+        const int MaxBins = 33;
+        Index bins[MaxBins];
+        for (int i = 0; i < MaxBins; i++)
+            bins[i] = Null;
+        int fill = 0;
+        Index rest = head;
+        Index carry = Null;
+        try {
+            while (rest != Null) {
+                carry = rest;
+                rest = slots[rest].next;
+                slots[carry].next = Null;
+                int i = 0;
+                for (; i < fill && bins[i] != Null; i++) {
+                    Index newer = carry;
+                    carry = Null;
+                    mergeChains(bins[i], newer, comp);
+                    carry = bins[i];
+                    bins[i] = Null;
+                }
+                bins[i] = carry;
+                carry = Null;
+                if (i == fill)
+                    fill++;
+            }
+            for (int i = 0; i < fill; i++) {
+                if (bins[i] == Null)
+                    continue;
+                Index newer = carry;
+                carry = Null;
+                mergeChains(bins[i], newer, comp);
+                carry = bins[i];
+                bins[i] = Null;
+            }
+        } catch (...) {
+            for (int i = 0; i < fill; i++)
+                appendChain(carry, bins[i]);
+            appendChain(carry, rest);
+            relinkChain(carry);
+            throw;
+        }
+        relinkChain(carry);
+    }
+
+    /*---------------------------------------------------------------
+     * Função merge()
+     * Descrição: Intercala em O(n + m) a lista ordenada 'other' nesta
+     *            lista (também ordenada). Estável: em empate os
+     *            elementos desta lista vêm primeiro. Os valores de
+     *            'other' são movidos para posições livres desta lista e
+     *            'other' fica vazia; merge(*this) não altera a lista.
+     *            Lança length_error, sem alterar as listas, se os
+     *            elementos de 'other' não couberem.
+     * Parâmetros:
+     *    - other: lista ordenada pelo mesmo critério (de qualquer
+     *             capacidade).
+     *    - comp: comparação "menor que" (padrão: operator<).
+     *---------------------------------------------------------------*/
+    template <size_t M>
+    LISTA_CONSTEXPR14 void merge(StaticDoublyLinkedList<T, M>& other) {
+        check(try_merge(other));
+    }
+
+    template <size_t M, typename Compare>
+    LISTA_CONSTEXPR14 void merge(StaticDoublyLinkedList<T, M>& other, Compare comp) {
+        check(try_merge(other, comp));
+    }
+
+    LISTA_CONSTEXPR14 void insertSorted(const T& value) {
+        insertSorted(value, less<T>());
+    }
+
+    // Insere depois dos elementos iguais; compara primeiro com o tail.
+    template <typename Compare>
+    LISTA_CONSTEXPR14 void insertSorted(const T& value, Compare comp) {
+        Index refSlot = Null;
+        if (tail != Null && comp(value, slots[tail].data)) {
+            refSlot = head;
+            while (!comp(value, slots[refSlot].data))
+                refSlot = slots[refSlot].next;
+        }
+        check(insertBefore(refSlot, value));
+    }
+
+    LISTA_CONSTEXPR14 int unique() {
+        return unique(equal_to<T>());
+    }
+
+    template <typename BinaryPredicate>
+    LISTA_CONSTEXPR14 int unique(BinaryPredicate equal) {
+        int removed = 0;
+        Index kept = head;
+        while (kept != Null && slots[kept].next != Null) {
+            Index current = slots[kept].next;
+            if (equal(slots[kept].data, slots[current].data)) {
+                removeSlot(current);
+                removed++;
+            } else {
+                kept = current;
+            }
+        }
+        return removed;
+    }
+
+    /*---------------------------------------------------------------
+     * Função swap()
+     * Descrição: Troca o conteúdo com outra lista de mesma capacidade,
+     *            posição a posição (O(N)).
+     *---------------------------------------------------------------*/
+    LISTA_CONSTEXPR14 void swap(StaticDoublyLinkedList& other) {
+        for (size_t i = 0; i < N; i++) {
+            T value(std::move(slots[i].data));
+            slots[i].data = std::move(other.slots[i].data);
+            other.slots[i].data = std::move(value);
+            Index next = slots[i].next;
+            slots[i].next = other.slots[i].next;
+            other.slots[i].next = next;
+            Index prev = slots[i].prev;
+            slots[i].prev = other.slots[i].prev;
+            other.slots[i].prev = prev;
+        }
+        Index indices[4] = {head, tail, freeList, used};
+        head = other.head;
+        tail = other.tail;
+        freeList = other.freeList;
+        used = other.used;
+        other.head = indices[0];
+        other.tail = indices[1];
+        other.freeList = indices[2];
+        other.used = indices[3];
+        int otherSize = other.size;
+        other.size = size;
+        size = otherSize;
+    }
+
+    void print(int index) const {
+        try {
+            cout << "Elemento no índice " << index << ": " << get(index) << endl;
+        } catch (const exception& e) {
+            cout << "Erro ao imprimir: " << e.what() << endl;
+        }
+    }
+
+    void printAll() const {
+        if (head == Null) {
+            cout << "Lista vazia." << endl;
+            return;
+        }
+        cout << "Elementos da lista: ";
+        for (Index current = head; current != Null; current = slots[current].next) {
+            cout << slots[current].data;
+            if (slots[current].next != Null)
+                cout << " -> ";
+        }
+        cout << endl;
+    }
+
+    LISTA_CONSTEXPR14 iterator begin() { return iterator(head, this); }
+    LISTA_CONSTEXPR14 iterator end() { return iterator(Null, this); }
+    constexpr const_iterator begin() const { return const_iterator(head, this); }
+    constexpr const_iterator end() const { return const_iterator(Null, this); }
+    constexpr const_iterator cbegin() const { return begin(); }
+    constexpr const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    // Insere antes de pos. Lança length_error se a lista estiver cheia.
+    LISTA_CONSTEXPR14 iterator insert(const_iterator pos, const T& value) {
+        check(insertBefore(pos.index, value));
+        return iterator(slotBefore(pos.index), this);
+    }
+
+    LISTA_CONSTEXPR14 iterator insert(const_iterator pos, T&& value) {
+        check(insertBefore(pos.index, std::move(value)));
+        return iterator(slotBefore(pos.index), this);
+    }
+
+    template <typename... Args>
+    LISTA_CONSTEXPR14 iterator emplace(const_iterator pos, Args&&... args) {
+        check(emplaceBefore(pos.index, std::forward<Args>(args)...));
+        return iterator(slotBefore(pos.index), this);
+    }
+
+    // Remove o nó apontado por pos. Lança runtime_error com end().
+    LISTA_CONSTEXPR14 iterator erase(const_iterator pos) {
+        if (pos.index == Null)
+            throw runtime_error("Operação inválida: nó nulo.");
+        Index next = slots[pos.index].next;
+        removeSlot(pos.index);
+        return iterator(next, this);
+    }
+};
+
+template <typename T, size_t N>
+const typename StaticDoublyLinkedList<T, N>::Index StaticDoublyLinkedList<T, N>::Null;
+
+/*---------------------------------------------------------------
+ * Função template try_deslocate() (lista estática)
+ * Descrição: Desloca o elemento do índice 'index' da lista 'source'
+ *            para a posição 'newIndex' na lista 'dest' (as capacidades
+ *            podem ser diferentes). Na mesma lista o nó é religado;
+ *            entre listas o valor é movido para uma posição livre de
+ *            'dest'. Não lança exceção: retorna ListOutOfRange ou
+ *            ListFull sem alterar as listas.
+ *---------------------------------------------------------------*/
+template <typename T, size_t N, size_t M>
+LISTA_CONSTEXPR14 ListStatus try_deslocate(StaticDoublyLinkedList<T, N>& source, StaticDoublyLinkedList<T, M>& dest,
+                                           int index, int newIndex) {
+    typedef typename StaticDoublyLinkedList<T, N>::Index SourceIndex;
+    typedef typename StaticDoublyLinkedList<T, M>::Index DestIndex;
+    bool sameList = static_cast<const void*>(&source) == static_cast<const void*>(&dest);
+    if (index < 0 || index >= source.size)
+        return ListOutOfRange;
+    int destSize = sameList ? dest.size - 1 : dest.size;
+    if (newIndex < 0 || newIndex > destSize)
+        return ListOutOfRange;
+    SourceIndex slot = source.slotAt(index);
+    if (sameList) {
+        source.unlinkSlot(slot);
+        source.linkSlotBefore(slot, (newIndex == source.size) ? source.Null : source.slotAt(newIndex));
+        return ListOk;
+    }
+    DestIndex refSlot = (newIndex == dest.size) ? dest.Null : dest.slotAt(newIndex);
+    if (dest.insertBefore(refSlot, std::move(source.slots[slot].data)) != ListOk)
+        return ListFull;
+    source.removeSlot(slot);
+    return ListOk;
+}
+
+/*---------------------------------------------------------------
+ * Função template deslocate() (lista estática)
+ * Descrição: Mesma operação de try_deslocate, com as exceções da
+ *            DoublyLinkedList (e length_error se 'dest' estiver cheia).
+ *---------------------------------------------------------------*/
+template <typename T, size_t N, size_t M>
+LISTA_CONSTEXPR14 void deslocate(StaticDoublyLinkedList<T, N>& source, StaticDoublyLinkedList<T, M>& dest,
+                                 int index, int newIndex) {
+    ListStatus status = try_deslocate(source, dest, index, newIndex);
+    if (status == ListFull)
+        throw length_error("Lista estática cheia.");
+    if (status != ListOk)
+        throw out_of_range("Índice fora dos limites da lista.");
+}
+
+/*---------------------------------------------------------------
+ * Função template try_splice() (lista estática)
+ * Descrição: Move os elementos das posições [first, last) da lista
+ *            'source' para antes da posição 'pos' da lista 'dest' (as
+ *            capacidades podem ser diferentes). Na mesma lista o
+ *            intervalo é desanexado e religado de uma vez; entre listas
+ *            os valores são movidos para posições livres de 'dest'. A
+ *            posição 'pos' é considerada antes da remoção do intervalo.
+ *            Não lança exceção: retorna ListOutOfRange (limites
+ *            inválidos ou 'pos' dentro do intervalo) ou ListFull sem
+ *            alterar as listas.
+ *---------------------------------------------------------------*/
+template <typename T, size_t N, size_t M>
+LISTA_CONSTEXPR14 ListStatus try_splice(StaticDoublyLinkedList<T, N>& dest, int pos,
+                                        StaticDoublyLinkedList<T, M>& source, int first, int last) {
+    typedef typename StaticDoublyLinkedList<T, M>::Index SourceIndex;
+    typedef typename StaticDoublyLinkedList<T, N>::Index DestIndex;
+    bool sameList = static_cast<const void*>(&source) == static_cast<const void*>(&dest);
+    if (first < 0 || last > source.size || first > last || pos < 0 || pos > dest.size)
+        return ListOutOfRange;
+    if (sameList && pos > first && pos < last)
+        return ListOutOfRange;
+    int count = last - first;
+    if (count == 0 || (sameList && (pos == first || pos == last)))
+        return ListOk; // Sem alteração
+    if (!sameList && count > static_cast<int>(N) - dest.size)
+        return ListFull;
+    SourceIndex slot = source.slotAt(first);
+    if (sameList) {
+        // Localiza o nó de referência antes de desanexar o intervalo
+        SourceIndex refSlot = (pos == source.size) ? source.Null : source.slotAt(pos);
+        SourceIndex lastSlot = source.slotAt(last - 1);
+        source.unlinkRange(slot, lastSlot, count);
+        source.linkRangeBefore(slot, lastSlot, count, refSlot);
+        return ListOk;
+    }
+    DestIndex refSlot = (pos == dest.size) ? dest.Null : dest.slotAt(pos);
+    for (int i = 0; i < count; i++) {
+        SourceIndex next = source.slots[slot].next;
+        dest.insertBefore(refSlot, std::move(source.slots[slot].data));
+        source.removeSlot(slot);
+        slot = next;
+    }
+    return ListOk;
+}
+
+/*---------------------------------------------------------------
+ * Função template splice() (lista estática)
+ * Descrição: Mesma operação de try_splice, com as exceções da
+ *            splice da DoublyLinkedList (e length_error se 'dest' não
+ *            comportar o intervalo).
+ *---------------------------------------------------------------*/
+template <typename T, size_t N, size_t M>
+LISTA_CONSTEXPR14 void splice(StaticDoublyLinkedList<T, N>& dest, int pos,
+                              StaticDoublyLinkedList<T, M>& source, int first, int last) {
+    if (first < 0 || last > source.length() || first > last)
+        throw out_of_range("Intervalo fora dos limites da lista.");
+    if (pos < 0 || pos > dest.length())
+        throw out_of_range("Índice fora dos limites da lista.");
+    bool sameList = static_cast<const void*>(&source) == static_cast<const void*>(&dest);
+    if (sameList && pos > first && pos < last)
+        throw invalid_argument("Posição de destino dentro do intervalo a ser movido.");
+    if (try_splice(dest, pos, source, first, last) == ListFull)
+        throw length_error("Lista estática cheia.");
+}
+
+#endif // STATIC_DOUBLY_LINKED_LIST_H
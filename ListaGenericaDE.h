@@ -1,8 +1,21 @@
 #ifndef DOUBLY_LINKED_LIST_H
 #define DOUBLY_LINKED_LIST_H
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 using namespace std;
 
 /*
@@ -33,8 +46,808 @@ struct Node {
     Node<T>* next;     // Ponteiro para o próximo nó
     Node<T>* prev;     // Ponteiro para o nó anterior
 
-    // Construtor que inicializa o nó com o valor fornecido
-    Node(const T& value) : data(value), next(nullptr), prev(nullptr) {}
+    // Construtor que inicializa o nó repassando os argumentos ao construtor
+    // de T (cópia, movimentação ou construção no local, sem cópias extras)
+    template <typename... Args>
+    explicit Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
+};
+
+/*---------------------------------------------------------------
+ * Política HeapNodeAllocator
+ * Descrição: Alocador padrão dos nós. Cada nó é criado com new e
+ *            liberado com delete individualmente.
+ * Interface esperada de toda política de alocação:
+ *    - create(args...): constrói e retorna um novo nó, repassando
+ *                       args ao construtor de T.
+ *    - destroy(node): destrói um único nó.
+ *    - destroyAll(first): destrói a cadeia iniciada em first
+ *                         (seguindo next) de uma só vez. Só pode ser
+ *                         chamada com a cadeia completa da lista (a
+ *                         arena libera todos os seus slabs); trechos
+ *                         parciais devem ser liberados nó a nó com
+ *                         destroy().
+ *    - swap(other): troca o estado com outro alocador do mesmo tipo.
+ *    - interchangeable: true se um nó criado por uma instância pode ser
+ *                       liberado por outra (permite que deslocate e
+ *                       splice troquem nós entre listas sem copiar).
+ *    Políticas com estado também devem ser movíveis.
+ *---------------------------------------------------------------*/
+template <typename T>
+class HeapNodeAllocator {
+public:
+    static const bool interchangeable = true;
+
+    template <typename... Args>
+    Node<T>* create(Args&&... args) {
+        return new Node<T>(std::forward<Args>(args)...);
+    }
+
+    void destroy(Node<T>* node) {
+        delete node;
+    }
+
+    void destroyAll(Node<T>* first) {
+        while (first != nullptr) {
+            Node<T>* next = first->next;
+            delete first;
+            first = next;
+        }
+    }
+
+    void swap(HeapNodeAllocator&) {}
+};
+
+/*---------------------------------------------------------------
+ * Política PoolNodeAllocator
+ * Descrição: Pool de nós baseado em slabs. Os nós são reservados em
+ *            blocos de SlabSize posições e os nós liberados voltam
+ *            para uma free-list, sendo reaproveitados pelas próximas
+ *            inserções sem chamar malloc. A memória dos slabs só é
+ *            devolvida ao sistema na destruição do pool.
+ * Glossário:
+ *    - slabs: lista encadeada dos blocos reservados.
+ *    - freeList: posições livres prontas para reuso.
+ *---------------------------------------------------------------*/
+template <typename T, int SlabSize = 64>
+class PoolNodeAllocator {
+private:
+    union Slot {
+        Slot* nextFree;   // Próxima posição livre (quando não está em uso)
+        typename aligned_storage<sizeof(Node<T>), alignof(Node<T>)>::type storage;
+    };
+
+    struct Slab {
+        Slab* next;
+        Slot slots[SlabSize];
+    };
+
+    Slab* slabs;
+    Slot* freeList;
+
+    // Reserva um novo slab e coloca todas as suas posições na free-list.
+    void grow() {
+        Slab* slab = new Slab;
+        slab->next = slabs;
+        slabs = slab;
+        for (int i = SlabSize - 1; i >= 0; i--) {
+            slab->slots[i].nextFree = freeList;
+            freeList = &slab->slots[i];
+        }
+    }
+
+    PoolNodeAllocator(const PoolNodeAllocator&);
+    PoolNodeAllocator& operator=(const PoolNodeAllocator&);
+
+public:
+    // Cada pool é dono dos seus slabs: nós não podem mudar de pool
+    static const bool interchangeable = false;
+
+    PoolNodeAllocator() : slabs(nullptr), freeList(nullptr) {}
+
+    PoolNodeAllocator(PoolNodeAllocator&& other) : slabs(other.slabs), freeList(other.freeList) {
+        other.slabs = nullptr;
+        other.freeList = nullptr;
+    }
+
+    ~PoolNodeAllocator() {
+        while (slabs != nullptr) {
+            Slab* next = slabs->next;
+            delete slabs;
+            slabs = next;
+        }
+    }
+
+    template <typename... Args>
+    Node<T>* create(Args&&... args) {
+        if (freeList == nullptr)
+            grow();
+        Slot* slot = freeList;
+        freeList = slot->nextFree;
+        try {
+            return new (&slot->storage) Node<T>(std::forward<Args>(args)...);
+        } catch (...) {
+            // Devolve a posição se o construtor de T lançar exceção
+            slot->nextFree = freeList;
+            freeList = slot;
+            throw;
+        }
+    }
+
+    void destroy(Node<T>* node) {
+        node->~Node<T>();
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->nextFree = freeList;
+        freeList = slot;
+    }
+
+    void destroyAll(Node<T>* first) {
+        while (first != nullptr) {
+            Node<T>* next = first->next;
+            destroy(first);
+            first = next;
+        }
+    }
+
+    void swap(PoolNodeAllocator& other) {
+        std::swap(slabs, other.slabs);
+        std::swap(freeList, other.freeList);
+    }
+};
+
+/*---------------------------------------------------------------
+ * Política ArenaNodeAllocator
+ * Descrição: Arena de nós. As posições são entregues em sequência a
+ *            partir de slabs de SlabSize nós e nunca são reaproveitadas
+ *            individualmente: destroy() apenas destrói o dado. Toda a
+ *            memória é liberada de uma vez em destroyAll() (chamado
+ *            pelo destrutor da lista), sem percorrer os nós quando T
+ *            é trivialmente destrutível.
+ *            Indicada para listas montadas, usadas e descartadas, e
+ *            não para filas com remoções contínuas.
+ *---------------------------------------------------------------*/
+template <typename T, int SlabSize = 256>
+class ArenaNodeAllocator {
+private:
+    typedef typename aligned_storage<sizeof(Node<T>), alignof(Node<T>)>::type Storage;
+
+    struct Slab {
+        Slab* next;
+        Storage slots[SlabSize];
+    };
+
+    Slab* slabs;
+    int used;   // Posições já entregues do slab atual
+
+    void releaseSlabs() {
+        while (slabs != nullptr) {
+            Slab* next = slabs->next;
+            delete slabs;
+            slabs = next;
+        }
+        used = 0;
+    }
+
+    ArenaNodeAllocator(const ArenaNodeAllocator&);
+    ArenaNodeAllocator& operator=(const ArenaNodeAllocator&);
+
+public:
+    // Cada arena é dona dos seus slabs: nós não podem mudar de arena
+    static const bool interchangeable = false;
+
+    ArenaNodeAllocator() : slabs(nullptr), used(0) {}
+
+    ArenaNodeAllocator(ArenaNodeAllocator&& other) : slabs(other.slabs), used(other.used) {
+        other.slabs = nullptr;
+        other.used = 0;
+    }
+
+    ~ArenaNodeAllocator() {
+        releaseSlabs();
+    }
+
+    template <typename... Args>
+    Node<T>* create(Args&&... args) {
+        if (slabs == nullptr || used == SlabSize) {
+            Slab* slab = new Slab;
+            slab->next = slabs;
+            slabs = slab;
+            used = 0;
+        }
+        Node<T>* node = new (&slabs->slots[used]) Node<T>(std::forward<Args>(args)...);
+        used++;
+        return node;
+    }
+
+    void destroy(Node<T>* node) {
+        node->~Node<T>();
+    }
+
+    void destroyAll(Node<T>* first) {
+        if (!is_trivially_destructible<T>::value) {
+            while (first != nullptr) {
+                Node<T>* next = first->next;
+                first->~Node<T>();
+                first = next;
+            }
+        }
+        releaseSlabs();
+    }
+
+    void swap(ArenaNodeAllocator& other) {
+        std::swap(slabs, other.slabs);
+        std::swap(used, other.used);
+    }
+};
+
+/*---------------------------------------------------------------
+ * Política NoValueIndex
+ * Descrição: Índice de valores padrão (desativado). Não guarda nada e
+ *            a busca por valor percorre a lista a partir do head.
+ * Interface esperada de toda política de índice de valores:
+ *    - enabled: true se o índice precisa ser avisado de cada nó.
+ *    - insert(node): registra um nó que entrou na lista.
+ *    - erase(node): remove o registro de um nó que saiu da lista.
+ *    - linked(first, last, count): a sequência [first, last], já
+ *                                  registrada, foi (re)ligada à lista
+ *                                  (a ordem da lista mudou).
+ *    - find(value, head): retorna o nó escolhido para value ou nullptr.
+ *    - clear(), swap(other): descartam / trocam todos os registros.
+ *---------------------------------------------------------------*/
+template <typename T>
+class NoValueIndex {
+public:
+    static const bool enabled = false;
+
+    void insert(Node<T>*) {}
+    void erase(Node<T>*) {}
+    void linked(Node<T>*, Node<T>*, int) {}
+    void clear() {}
+    void swap(NoValueIndex&) {}
+
+    // Busca linear: retorna a primeira ocorrência na ordem da lista
+    Node<T>* find(const T& value, Node<T>* head) const {
+        Node<T>* current = head;
+        while (current != nullptr) {
+            if (current->data == value)
+                return current;
+            current = current->next;
+        }
+        return nullptr; // Caso o valor não seja encontrado
+    }
+};
+
+/*---------------------------------------------------------------
+ * Política HashValueIndex
+ * Descrição: Índice hash valor -> nós, mantido por todos os caminhos
+ *            de inserção e remoção da lista. Torna popByValue e
+ *            push(refValue, side) O(1) em média (O(log d) com d
+ *            duplicatas do valor).
+ *            Com valores duplicados, find() retorna a primeira
+ *            ocorrência na ordem da lista (o mesmo nó da NoValueIndex)
+ *            sem percorrer a lista: cada nó recebe um rótulo crescente
+ *            na ordem da lista, atribuído quando o nó é ligado (linked)
+ *            entre os rótulos dos vizinhos, e os nós de cada valor
+ *            formam um heap pelo rótulo. Quando não há espaço entre os
+ *            vizinhos, um trecho ao redor é reetiquetado, dobrando até
+ *            ficar esparso o bastante (custo amortizado O(log n) por nó
+ *            ligado). Nas extremidades os rótulos avançam em passos
+ *            fixos, de modo que push e pushFirst não esgotam o espaço.
+ *            Cada nó guarda a sua posição no índice, de modo que erase()
+ *            não depende de node->data (que pode já ter sido movido,
+ *            como em popAt).
+ *            O valor de um nó indexado deve ser alterado por set();
+ *            alterações por referência (operator[], get, iteradores)
+ *            não atualizam o índice. Nesse caso find() ignora os nós
+ *            cujo valor não confere mais (o novo valor não é encontrado
+ *            pelo índice), mas nunca acessa memória inválida.
+ * Glossário:
+ *    - buckets: para cada valor, o heap dos nós que o contêm.
+ *    - entries: para cada nó, o bucket e a posição dentro dele.
+ *---------------------------------------------------------------*/
+template <typename T, typename Hash = hash<T> >
+class HashValueIndex {
+private:
+    struct Ranked {
+        Node<T>* node;
+        unsigned long long order;   // Rótulo crescente na ordem da lista
+    };
+
+    typedef vector<Ranked> Bucket;  // Heap: menor rótulo em [0]
+    typedef unordered_map<T, Bucket, Hash> BucketMap;
+
+    struct Entry {
+        typename BucketMap::value_type* bucket; // Estável: rehash não move os elementos
+        size_t slot;                            // Posição do nó no heap
+    };
+
+    static const unsigned long long MaxOrder = ~0ULL;       // Após o tail
+    static const unsigned long long EdgeStep = 1ULL << 32;  // Passo nas extremidades
+
+    BucketMap buckets;
+    unordered_map<Node<T>*, Entry> entries;
+
+    unsigned long long orderOf(Node<T>* node) {
+        Entry& entry = entries.find(node)->second;
+        return entry.bucket->second[entry.slot].order;
+    }
+
+    void place(Bucket& nodes, size_t slot, const Ranked& ranked) {
+        nodes[slot] = ranked;
+        entries.find(ranked.node)->second.slot = slot;
+    }
+
+    // Restaura o heap a partir de slot, cujo rótulo mudou.
+    void restore(Bucket& nodes, size_t slot) {
+        Ranked moving = nodes[slot];
+        while (slot > 0 && moving.order < nodes[(slot - 1) / 2].order) {
+            place(nodes, slot, nodes[(slot - 1) / 2]);
+            slot = (slot - 1) / 2;
+        }
+        while (2 * slot + 1 < nodes.size()) {
+            size_t child = 2 * slot + 1;
+            if (child + 1 < nodes.size() && nodes[child + 1].order < nodes[child].order)
+                child++;
+            if (!(nodes[child].order < moving.order))
+                break;
+            place(nodes, slot, nodes[child]);
+            slot = child;
+        }
+        place(nodes, slot, moving);
+    }
+
+    // Atribui rótulos base + gap, base + 2 * gap, ... aos count nós a
+    // partir de first.
+    void assign(Node<T>* first, unsigned long long count, unsigned long long base, unsigned long long gap) {
+        for (unsigned long long i = 1; i <= count; i++, first = first->next) {
+            Entry& entry = entries.find(first)->second;
+            Bucket& nodes = entry.bucket->second;
+            nodes[entry.slot].order = base + gap * i;
+            restore(nodes, entry.slot);
+        }
+    }
+
+    // Reetiqueta [first, last] (count nós), ampliando o trecho para os
+    // dois lados até que o espaço entre os vizinhos comporte os nós com
+    // folga (ou até cobrir a lista inteira).
+    void relabel(Node<T>* first, Node<T>* last, unsigned long long count) {
+        while (true) {
+            unsigned long long low = (first->prev != nullptr) ? orderOf(first->prev) : 0;
+            unsigned long long high = (last->next != nullptr) ? orderOf(last->next) : MaxOrder;
+            unsigned long long gap = (high - low) / (count + 1);
+            if ((first->prev == nullptr && last->next == nullptr) || gap > count) {
+                assign(first, count, low, gap);
+                return;
+            }
+            for (unsigned long long k = count / 2 + 1; k > 0 && first->prev != nullptr; k--, count++)
+                first = first->prev;
+            for (unsigned long long k = count / 2 + 1; k > 0 && last->next != nullptr; k--, count++)
+                last = last->next;
+        }
+    }
+
+public:
+    static const bool enabled = true;
+
+    // O nó entra com o maior rótulo (fim do heap) até ser ligado.
+    void insert(Node<T>* node) {
+        typename BucketMap::iterator it = buckets.insert(make_pair(node->data, Bucket())).first;
+        Bucket& nodes = it->second;
+        Ranked ranked = {node, MaxOrder};
+        nodes.push_back(ranked);
+        try {
+            Entry entry = {&*it, nodes.size() - 1};
+            entries.insert(make_pair(node, entry));
+        } catch (...) {
+            nodes.pop_back();
+            if (nodes.empty())
+                buckets.erase(it);
+            throw;
+        }
+    }
+
+    void erase(Node<T>* node) {
+        typename unordered_map<Node<T>*, Entry>::iterator entry = entries.find(node);
+        if (entry == entries.end())
+            return;
+        Bucket& nodes = entry->second.bucket->second;
+        size_t slot = entry->second.slot;
+        // O último nó do heap ocupa a posição liberada
+        Ranked last = nodes.back();
+        nodes.pop_back();
+        if (slot < nodes.size()) {
+            place(nodes, slot, last);
+            restore(nodes, slot);
+        }
+        if (nodes.empty())
+            buckets.erase(buckets.find(entry->second.bucket->first));
+        entries.erase(entry);
+    }
+
+    // A sequência [first, last] (count nós já indexados) acabou de ser
+    // ligada à lista: rotula os nós entre os vizinhos.
+    void linked(Node<T>* first, Node<T>* last, int count) {
+        unsigned long long n = static_cast<unsigned long long>(count);
+        unsigned long long low = (first->prev != nullptr) ? orderOf(first->prev) : 0;
+        unsigned long long high = (last->next != nullptr) ? orderOf(last->next) : MaxOrder;
+        unsigned long long gap = (high - low) / (n + 1);
+        if (gap == 0) {
+            relabel(first, last, n);
+            return;
+        }
+        if (first->prev != nullptr && last->next == nullptr && gap > EdgeStep) {
+            gap = EdgeStep; // Final: deixa espaço para os próximos push
+        } else if (first->prev == nullptr && last->next != nullptr && gap > EdgeStep) {
+            gap = EdgeStep; // Início: deixa espaço para os próximos pushFirst
+            low = high - gap * (n + 1);
+        }
+        assign(first, n, low, gap);
+    }
+
+    void clear() {
+        buckets.clear();
+        entries.clear();
+    }
+
+    void swap(HashValueIndex& other) {
+        buckets.swap(other.buckets);
+        entries.swap(other.entries);
+    }
+
+    Node<T>* find(const T& value, Node<T>*) const {
+        typename BucketMap::const_iterator it = buckets.find(value);
+        if (it == buckets.end())
+            return nullptr;
+        const Bucket& nodes = it->second;
+        // Topo do heap: primeira ocorrência na ordem da lista
+        if (nodes.front().node->data == value)
+            return nodes.front().node;
+        // Valores alterados por referência: o menor rótulo que ainda confere
+        const Ranked* first = nullptr;
+        for (typename Bucket::const_iterator current = nodes.begin(); current != nodes.end(); ++current) {
+            if (current->node->data == value && (first == nullptr || current->order < first->order))
+                first = &*current;
+        }
+        return (first != nullptr) ? first->node : nullptr;
+    }
+};
+
+template <typename T, typename Hash>
+const unsigned long long HashValueIndex<T, Hash>::MaxOrder;
+
+template <typename T, typename Hash>
+const unsigned long long HashValueIndex<T, Hash>::EdgeStep;
+
+/*---------------------------------------------------------------
+ * Estrutura ListOperation
+ * Descrição: Métodos da API da lista para os quais a instrumentação
+ *            separa as métricas. Os métodos auxiliares (por exemplo,
+ *            push chamando emplace_back) são contabilizados apenas no
+ *            método chamado pelo usuário.
+ *---------------------------------------------------------------*/
+struct ListOperation {
+    enum Type {
+        Push, PushFirst, PushBeside, InsertAt, Insert, PushRange, InsertRange,
+        Pop, PopFirst, PopByValue, PopBeside, PopAt, Erase, RemoveIf, Clear,
+        Move, Get, Set, Deslocate, Splice,
+        Sort, Merge, InsertSorted, Unique, Other,
+        Count
+    };
+
+    static const char* name(Type op) {
+        static const char* const names[Count] = {
+            "push", "pushFirst", "pushBeside", "insertAt", "insert", "pushRange", "insertRange",
+            "pop", "popFirst", "popByValue", "popBeside", "popAt", "erase", "removeIf", "clear",
+            "move", "get", "set", "deslocate", "splice",
+            "sort", "merge", "insertSorted", "unique", "other"
+        };
+        return names[op];
+    }
+};
+
+/*---------------------------------------------------------------
+ * Política NoInstrumentation
+ * Descrição: Instrumentação padrão (desativada). Todos os métodos são
+ *            vazios e inline, e o compilador os elimina por completo.
+ * Interface esperada de toda política de instrumentação:
+ *    - enabled: true se a política coleta métricas.
+ *    - Scope(policy, op): objeto RAII criado no início de cada método
+ *                         da API; mede a latência e detecta exceções.
+ *    - traversed(n): n nós percorridos pela operação corrente.
+ *    - allocated(), freed(n): nós criados / liberados.
+ *---------------------------------------------------------------*/
+class NoInstrumentation {
+public:
+    static const bool enabled = false;
+
+    class Scope {
+    public:
+        Scope(NoInstrumentation&, ListOperation::Type) {}
+    };
+
+    void traversed(int) {}
+    void allocated() {}
+    void freed(int) {}
+};
+
+/*---------------------------------------------------------------
+ * Estrutura InstrumentationSnapshot
+ * Descrição: Cópia das métricas de uma CountingInstrumentation em um
+ *            instante, pronta para ser exportada.
+ * Glossário:
+ *    - latency[k]: chamadas com latência em [2^k, 2^(k+1)) ns (o
+ *                  bucket 0 inclui as chamadas abaixo de 1 ns).
+ *---------------------------------------------------------------*/
+struct InstrumentationSnapshot {
+    static const int LatencyBuckets = 40;
+
+    struct Operation {
+        unsigned long long calls;           // Chamadas concluídas ou não
+        unsigned long long exceptions;      // Chamadas encerradas por exceção
+        unsigned long long nodesTraversed;  // Nós percorridos em getNodeAt/getNodeByValue e varreduras
+        unsigned long long totalNs;         // Soma das latências
+        unsigned long long maxNs;           // Maior latência observada
+        unsigned long long latency[LatencyBuckets];
+
+        // Limite superior (em ns) do bucket que contém o percentil p (0 a 100).
+        unsigned long long percentileNs(double p) const {
+            unsigned long long target = static_cast<unsigned long long>(p / 100.0 * calls + 0.5);
+            if (target == 0)
+                target = 1;
+            unsigned long long seen = 0;
+            for (int k = 0; k < LatencyBuckets; k++) {
+                seen += latency[k];
+                if (seen >= target)
+                    return 2ULL << k;
+            }
+            return maxNs;
+        }
+    };
+
+    Operation operations[ListOperation::Count];
+    unsigned long long nodesAllocated;
+    unsigned long long nodesFreed;
+
+    const Operation& operator[](ListOperation::Type op) const {
+        return operations[op];
+    }
+};
+
+/*---------------------------------------------------------------
+ * Política CountingInstrumentation
+ * Descrição: Conta, por método da API, as chamadas, os nós percorridos,
+ *            as exceções lançadas e a distribuição de latência, além do
+ *            total de nós criados e liberados.
+ *            Os contadores são escritos apenas pela thread que usa a
+ *            lista (como a própria lista, a política não é thread-safe),
+ *            mas podem ser lidos por snapshot() em outra thread sem
+ *            leituras rasgadas. reset() deve ser chamado pela thread dona
+ *            da lista ou sob a mesma trava que protege a lista.
+ *---------------------------------------------------------------*/
+class CountingInstrumentation {
+private:
+    // Contador de escritor único: incremento sem instrução atômica de
+    // leitura-modificação-escrita, leitura segura por outras threads.
+    class Counter {
+    private:
+        atomic<unsigned long long> value;
+
+    public:
+        Counter() : value(0) {}
+
+        void add(unsigned long long n) {
+            value.store(value.load(memory_order_relaxed) + n, memory_order_relaxed);
+        }
+
+        void raise(unsigned long long n) {
+            if (n > value.load(memory_order_relaxed))
+                value.store(n, memory_order_relaxed);
+        }
+
+        unsigned long long load() const {
+            return value.load(memory_order_relaxed);
+        }
+
+        void reset() {
+            value.store(0, memory_order_relaxed);
+        }
+    };
+
+    struct OperationCounters {
+        Counter calls, exceptions, nodesTraversed, totalNs, maxNs;
+        Counter latency[InstrumentationSnapshot::LatencyBuckets];
+    };
+
+    OperationCounters operations[ListOperation::Count];
+    Counter nodesAllocated, nodesFreed;
+    ListOperation::Type current;   // Operação em andamento (para traversed)
+    int depth;                     // Escopos aninhados em andamento
+
+    CountingInstrumentation(const CountingInstrumentation&);
+    CountingInstrumentation& operator=(const CountingInstrumentation&);
+
+    static int bucketOf(unsigned long long ns) {
+        int k = 0;
+        while (ns > 1 && k < InstrumentationSnapshot::LatencyBuckets - 1) {
+            ns >>= 1;
+            k++;
+        }
+        return k;
+    }
+
+    void record(ListOperation::Type op, unsigned long long ns, bool threw) {
+        OperationCounters& c = operations[op];
+        c.calls.add(1);
+        if (threw)
+            c.exceptions.add(1);
+        c.totalNs.add(ns);
+        c.maxNs.raise(ns);
+        c.latency[bucketOf(ns)].add(1);
+    }
+
+public:
+    static const bool enabled = true;
+
+    CountingInstrumentation() : current(ListOperation::Other), depth(0) {}
+
+    // Apenas o escopo mais externo mede: chamadas internas entre métodos
+    // públicos não contam duas vezes.
+    // Antes do C++17 não existe uncaught_exceptions(): uncaught_exception()
+    // só diz se há alguma exceção em propagação. Uma chamada feita durante
+    // o desempilhamento de outra exceção (por exemplo, no destrutor de um
+    // objeto do usuário) é então registrada como concluída sem exceção,
+    // mesmo que lance e a exceção seja tratada dentro desse destrutor.
+    class Scope {
+    private:
+        CountingInstrumentation& policy;
+        ListOperation::Type op;
+        bool outermost;
+#if __cplusplus >= 201703L
+        int pendingExceptions;
+#else
+        bool unwinding;   // Já havia exceção em propagação na criação
+#endif
+        chrono::steady_clock::time_point start;
+
+        Scope(const Scope&);
+        Scope& operator=(const Scope&);
+
+    public:
+        Scope(CountingInstrumentation& p, ListOperation::Type operation)
+            : policy(p), op(operation), outermost(p.depth++ == 0) {
+            if (outermost) {
+                policy.current = op;
+#if __cplusplus >= 201703L
+                pendingExceptions = uncaught_exceptions();
+#else
+                unwinding = uncaught_exception();
+#endif
+                start = chrono::steady_clock::now();
+            }
+        }
+
+        ~Scope() {
+            policy.depth--;
+            if (!outermost)
+                return;
+            unsigned long long ns = static_cast<unsigned long long>(
+                chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+#if __cplusplus >= 201703L
+            bool threw = uncaught_exceptions() > pendingExceptions;
+#else
+            bool threw = !unwinding && uncaught_exception();
+#endif
+            policy.record(op, ns, threw);
+            policy.current = ListOperation::Other;
+        }
+    };
+
+    void traversed(int n) {
+        operations[current].nodesTraversed.add(static_cast<unsigned long long>(n));
+    }
+
+    void allocated() {
+        nodesAllocated.add(1);
+    }
+
+    void freed(int n) {
+        nodesFreed.add(static_cast<unsigned long long>(n));
+    }
+
+    /*---------------------------------------------------------------
+     * Função snapshot()
+     * Descrição: Copia todas as métricas acumuladas desde a criação da
+     *            lista ou do último reset().
+     *---------------------------------------------------------------*/
+    InstrumentationSnapshot snapshot() const {
+        InstrumentationSnapshot s;
+        for (int op = 0; op < ListOperation::Count; op++) {
+            const OperationCounters& c = operations[op];
+            InstrumentationSnapshot::Operation& o = s.operations[op];
+            o.calls = c.calls.load();
+            o.exceptions = c.exceptions.load();
+            o.nodesTraversed = c.nodesTraversed.load();
+            o.totalNs = c.totalNs.load();
+            o.maxNs = c.maxNs.load();
+            for (int k = 0; k < InstrumentationSnapshot::LatencyBuckets; k++)
+                o.latency[k] = c.latency[k].load();
+        }
+        s.nodesAllocated = nodesAllocated.load();
+        s.nodesFreed = nodesFreed.load();
+        return s;
+    }
+
+    /*---------------------------------------------------------------
+     * Função reset()
+     * Descrição: Zera todas as métricas.
+     *---------------------------------------------------------------*/
+    void reset() {
+        for (int op = 0; op < ListOperation::Count; op++) {
+            OperationCounters& c = operations[op];
+            c.calls.reset();
+            c.exceptions.reset();
+            c.nodesTraversed.reset();
+            c.totalNs.reset();
+            c.maxNs.reset();
+            for (int k = 0; k < InstrumentationSnapshot::LatencyBuckets; k++)
+                c.latency[k].reset();
+        }
+        nodesAllocated.reset();
+        nodesFreed.reset();
+    }
+};
+
+/*---------------------------------------------------------------
+ * Template da estrutura PositionCursor
+ * Descrição: Cursor de acesso posicional: o último nó localizado por
+ *            getNodeAt e a sua posição. Acessos a posições próximas
+ *            (por exemplo, laços for com list[i]) partem do cursor em
+ *            vez de head/tail, em O(1) amortizado. As alterações da
+ *            lista ajustam ou invalidam o cursor.
+ *            Leitores const podem usar a mesma lista em várias
+ *            threads: o cursor é protegido por uma trava tentativa
+ *            (busy) e quem não a obtém percorre a partir das
+ *            extremidades, sem consultar nem atualizar o cursor.
+ *            Cópias começam sem cursor.
+ * Glossário:
+ *    - node: nó do cursor (nullptr quando inválido).
+ *    - index: posição de node na lista.
+ *    - busy: trava do cursor durante getNodeAt.
+ *---------------------------------------------------------------*/
+template <typename T>
+struct PositionCursor {
+    Node<T>* node;
+    int index;
+    atomic<bool> busy;
+
+    PositionCursor() : node(nullptr), index(0), busy(false) {}
+    PositionCursor(const PositionCursor&) : node(nullptr), index(0), busy(false) {}
+
+    PositionCursor& operator=(const PositionCursor&) {
+        node = nullptr;
+        return *this;
+    }
+
+    bool tryLock() {
+        return !busy.exchange(true, memory_order_acquire);
+    }
+
+    void unlock() {
+        busy.store(false, memory_order_release);
+    }
+
+    void set(Node<T>* n, int i) {
+        node = n;
+        index = i;
+    }
+
+    void reset() {
+        node = nullptr;
+    }
+
+    void swap(PositionCursor& other) {
+        std::swap(node, other.node);
+        std::swap(index, other.index);
+    }
 };
 
 /*---------------------------------------------------------------
@@ -42,35 +855,256 @@ struct Node {
  * Descrição: Implementa uma lista duplamente encadeada com diversas
  *            operações, como inserção, remoção, movimentação e 
  *            deslocamento de nós entre listas.
+ * Parâmetros do template:
+ *    - T: tipo do dado armazenado.
+ *    - Allocator: política de alocação dos nós (HeapNodeAllocator,
+ *                 PoolNodeAllocator ou ArenaNodeAllocator).
+ *    - ValueIndex: política de índice de valores (NoValueIndex ou
+ *                  HashValueIndex).
+ *    - Instrumentation: política de métricas (NoInstrumentation ou
+ *                       CountingInstrumentation).
  *---------------------------------------------------------------*/
-template <typename T>
+template <typename T, typename Allocator = HeapNodeAllocator<T>, typename ValueIndex = NoValueIndex<T>,
+          typename Instrumentation = NoInstrumentation>
 class DoublyLinkedList {
 private:
+    Allocator allocator; // Política responsável por criar e destruir os nós
+    ValueIndex valueIndex; // Política de busca por valor
+    mutable Instrumentation metrics; // Política de métricas (atualizada também em métodos const)
     Node<T>* head;   // Ponteiro para o primeiro nó da lista
+    Node<T>* tail;   // Ponteiro para o último nó da lista
     int size;        // Número de elementos presentes na lista
+    mutable PositionCursor<T> cursor; // Último nó localizado por posição
+
+    // Funções livres que religam nós diretamente entre listas
+    template <typename U, typename A, typename I, typename M>
+    friend void deslocate(DoublyLinkedList<U, A, I, M>& source, DoublyLinkedList<U, A, I, M>& dest, int index, int newIndex);
+    template <typename U, typename A, typename I, typename M>
+    friend void splice(DoublyLinkedList<U, A, I, M>& dest, int pos, DoublyLinkedList<U, A, I, M>& source, int first, int last);
+    template <typename U, typename A, typename I, typename M, typename Compare>
+    friend void parallelSort(DoublyLinkedList<U, A, I, M>& list, Compare comp, unsigned threads);
 
     // Método auxiliar para obter o nó na posição index.
+    // Percorre a partir do ponto mais próximo do índice: head, tail ou o
+    // cursor, que passa a apontar para o nó encontrado.
     // Lança exceção se o índice estiver fora dos limites.
     Node<T>* getNodeAt(int index) const {
         if (index < 0 || index >= size)
             throw out_of_range("Índice fora dos limites da lista.");
         Node<T>* current = head;
-        for (int i = 0; i < index; i++) {
+        int position = 0;
+        if (index >= size / 2) {
+            current = tail;
+            position = size - 1;
+        }
+        bool locked = cursor.tryLock();
+        if (locked && cursor.node != nullptr && abs(index - cursor.index) < abs(index - position)) {
+            current = cursor.node;
+            position = cursor.index;
+        }
+        metrics.traversed(abs(index - position));
+        for (; position < index; position++)
             current = current->next;
+        for (; position > index; position--)
+            current = current->prev;
+        if (locked) {
+            cursor.set(current, index);
+            cursor.unlock();
+        }
+        return current;
+    }
+
+    // Método auxiliar para buscar um nó com o valor especificado.
+    // Delega à política de índice (busca linear ou hash).
+    // Retorna o ponteiro para o nó ou nullptr se não encontrar.
+    Node<T>* getNodeByValue(const T& value) const {
+        if (Instrumentation::enabled && !ValueIndex::enabled) {
+            // Mesma busca linear da NoValueIndex, contando os nós visitados
+            int steps = 0;
+            Node<T>* current = head;
+            while (current != nullptr && !(current->data == value)) {
+                current = current->next;
+                steps++;
+            }
+            metrics.traversed(steps);
+            return current;
+        }
+        return valueIndex.find(value, head);
+    }
+
+    // Método auxiliar para criar um nó e registrá-lo no índice de valores.
+    template <typename... Args>
+    Node<T>* createNode(Args&&... args) {
+        Node<T>* node = allocator.create(std::forward<Args>(args)...);
+        try {
+            valueIndex.insert(node);
+        } catch (...) {
+            allocator.destroy(node);
+            throw;
+        }
+        metrics.allocated();
+        return node;
+    }
+
+    // Método auxiliar para retirar um nó do índice e liberá-lo.
+    void destroyNode(Node<T>* node) {
+        valueIndex.erase(node);
+        allocator.destroy(node);
+        metrics.freed(1);
+    }
+
+    // Método auxiliar para liberar a cadeia inteira de uma vez (usado
+    // por clear() e pelo destrutor) e deixar a lista vazia.
+    void releaseAll() {
+        metrics.freed(size);
+        valueIndex.clear();
+        allocator.destroyAll(head);
+        cursor.reset();
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+
+    // Método auxiliar para desanexar a sequência contígua [first, last]
+    // (com count nós) sem liberar a memória. Atualiza head/tail e o
+    // tamanho; a sequência fica com first->prev e last->next nulos.
+    void unlinkRange(Node<T>* first, Node<T>* last, int count) {
+        adjustCursorForUnlink(first, last, count);
+        if (first->prev != nullptr)
+            first->prev->next = last->next;
+        else
+            head = last->next;
+        if (last->next != nullptr)
+            last->next->prev = first->prev;
+        else
+            tail = first->prev;
+        first->prev = nullptr;
+        last->next = nullptr;
+        size -= count;
+    }
+
+    // Método auxiliar para anexar a sequência [first, last] (com count nós)
+    // antes de refNode. Se refNode for nullptr, anexa ao final da lista.
+    void linkRangeBefore(Node<T>* first, Node<T>* last, int count, Node<T>* refNode) {
+        adjustCursorForLink(count, refNode);
+        last->next = refNode;
+        first->prev = (refNode != nullptr) ? refNode->prev : tail;
+        if (first->prev != nullptr)
+            first->prev->next = first;
+        else
+            head = first;
+        if (refNode != nullptr)
+            refNode->prev = last;
+        else
+            tail = last;
+        size += count;
+        valueIndex.linked(first, last, count);
+    }
+
+    // Método auxiliar para manter o cursor válido antes de desanexar
+    // [first, last]: ajusta a posição quando os nós retirados estão nas
+    // extremidades ou junto ao cursor; nos demais casos o invalida.
+    void adjustCursorForUnlink(Node<T>* first, Node<T>* last, int count) {
+        if (cursor.node == nullptr)
+            return;
+        if (last->next == nullptr) {
+            // Retirada do final: só o cursor dentro do trecho muda
+            if (cursor.index >= size - count)
+                cursor.set(first->prev, size - count - 1);
+        } else if (first->prev == nullptr) {
+            // Retirada do início: as posições recuam count
+            if (cursor.index < count)
+                cursor.set(last->next, 0);
+            else
+                cursor.index -= count;
+        } else if (cursor.node == first) {
+            cursor.node = last->next;
+        } else if (cursor.node == last->next) {
+            cursor.index -= count;
+        } else if (cursor.node != first->prev) {
+            cursor.reset();
+        }
+    }
+
+    // Método auxiliar para manter o cursor válido antes de anexar count
+    // nós antes de refNode (nullptr: ao final).
+    void adjustCursorForLink(int count, Node<T>* refNode) {
+        if (cursor.node == nullptr || refNode == nullptr || refNode->prev == cursor.node)
+            return; // Posição do cursor inalterada
+        if (refNode == cursor.node || refNode == head)
+            cursor.index += count;
+        else
+            cursor.reset();
+    }
+
+    // Método auxiliar para desanexar um nó da lista sem liberar a memória.
+    void unlinkNode(Node<T>* node) {
+        unlinkRange(node, node, 1);
+    }
+
+    // Método auxiliar para anexar um nó já criado antes de refNode.
+    // Se refNode for nullptr, o nó é anexado ao final da lista.
+    void linkNodeBefore(Node<T>* node, Node<T>* refNode) {
+        linkRangeBefore(node, node, 1, refNode);
+    }
+
+    // Método auxiliar para assumir a sequência desanexada [first, last]
+    // (com count nós) vinda da lista 'from', onde estava antes de
+    // fromRef. Quando os nós podem trocar de lista (mesma lista ou
+    // alocador intercambiável) os nós são mantidos e apenas transferidos
+    // entre os índices de valores (se houver); caso contrário cada valor
+    // é movido (ou copiado, se o construtor de movimento puder lançar)
+    // para um nó criado pelo alocador desta lista, e os nós originais só
+    // são devolvidos ao alocador de 'from' depois que todos os novos nós
+    // forem criados. Se a criação falhar, os novos nós são liberados um a
+    // um, os valores já movidos voltam aos nós originais e a sequência é
+    // religada em 'from' na posição de origem: nenhum elemento se perde.
+    void adoptRange(DoublyLinkedList& from, Node<T>*& first, Node<T>*& last, int count, Node<T>* fromRef) {
+        if (&from == this)
+            return;
+        if (Allocator::interchangeable) {
+            if (ValueIndex::enabled) {
+                for (Node<T>* current = first; current != nullptr; current = current->next) {
+                    from.valueIndex.erase(current);
+                    valueIndex.insert(current);
+                }
+            }
+            return;
+        }
+        Node<T>* newFirst = nullptr;
+        Node<T>* newLast = nullptr;
+        try {
+            for (Node<T>* current = first; current != nullptr; current = current->next) {
+                Node<T>* copy = createNode(std::move_if_noexcept(current->data));
+                copy->prev = newLast;
+                if (newLast != nullptr)
+                    newLast->next = copy;
+                else
+                    newFirst = copy;
+                newLast = copy;
+            }
+        } catch (...) {
+            // Mesma condição de move_if_noexcept: os valores foram movidos
+            const bool moved = is_nothrow_move_constructible<T>::value || !is_copy_constructible<T>::value;
+            Node<T>* original = first;
+            while (newFirst != nullptr) {
+                Node<T>* next = newFirst->next;
+                if (moved)
+                    original->data = std::move(newFirst->data);
+                destroyNode(newFirst);
+                original = original->next;
+                newFirst = next;
+            }
+            from.linkRangeBefore(first, last, count, fromRef);
+            throw;
         }
-        return current;
-    }
-
-    // Método auxiliar para buscar um nó com o valor especificado.
-    // Retorna o ponteiro para o nó ou nullptr se não encontrar.
-    Node<T>* getNodeByValue(const T& value) const {
-        Node<T>* current = head;
-        while (current != nullptr) {
-            if (current->data == value)
-                return current;
-            current = current->next;
+        while (first != nullptr) {
+            Node<T>* next = first->next;
+            from.destroyNode(first);
+            first = next;
         }
-        return nullptr; // Caso o valor não seja encontrado
+        first = newFirst;
+        last = newLast;
     }
 
     // Método auxiliar para remover (desanexar) um nó específico.
@@ -78,17 +1112,178 @@ private:
     void removeNode(Node<T>* node) {
         if (node == nullptr)
             throw runtime_error("Operação inválida: nó nulo.");
-        if (node == head) { // Se o nó a ser removido é o primeiro da lista
-            head = node->next;
-            if (head != nullptr)
-                head->prev = nullptr;
+        unlinkNode(node);
+        destroyNode(node);
+    }
+
+    // Método auxiliar para criar, em uma única passada, a cadeia desanexada
+    // com cópias dos valores de [first, last). Retorna a quantidade de nós
+    // criados. Se a criação de algum nó falhar, os já criados são
+    // liberados e a exceção é relançada (a lista não é alterada).
+    template <typename InputIt>
+    int buildChain(InputIt first, InputIt last, Node<T>*& chainFirst, Node<T>*& chainLast) {
+        chainFirst = nullptr;
+        chainLast = nullptr;
+        int count = 0;
+        try {
+            for (; first != last; ++first) {
+                Node<T>* node = createNode(*first);
+                node->prev = chainLast;
+                if (chainLast != nullptr)
+                    chainLast->next = node;
+                else
+                    chainFirst = node;
+                chainLast = node;
+                count++;
+            }
+        } catch (...) {
+            while (chainFirst != nullptr) {
+                Node<T>* next = chainFirst->next;
+                destroyNode(chainFirst);
+                chainFirst = next;
+            }
+            throw;
+        }
+        return count;
+    }
+
+    // Método auxiliar para intercalar, de forma estável, as cadeias
+    // ordenadas 'a' e 'b' (ligadas apenas por next). O resultado fica em
+    // 'a'; em empate o nó de 'a' vem primeiro. Se comp lançar exceção,
+    // 'a' recebe todos os nós (em ordem parcial) antes de relançá-la.
+    template <typename Compare>
+    static void mergeChains(Node<T>*& a, Node<T>* b, Compare& comp) {
+        Node<T>* first = nullptr;
+        Node<T>** link = &first;
+        try {
+            while (a != nullptr && b != nullptr) {
+                if (comp(b->data, a->data)) {
+                    *link = b;
+                    link = &b->next;
+                    b = b->next;
+                } else {
+                    *link = a;
+                    link = &a->next;
+                    a = a->next;
+                }
+            }
+        } catch (...) {
+            *link = a;
+            while (*link != nullptr)
+                link = &(*link)->next;
+            *link = b;
+            a = first;
+            throw;
+        }
+        *link = (a != nullptr) ? a : b;
+        a = first;
+    }
+
+    // Método auxiliar para ordenar, de forma estável, a cadeia 'first'
+    // ligada apenas por next (merge sort de baixo para cima, O(1) de
+    // memória extra). Se comp lançar exceção, 'first' recebe todos os nós
+    // (em ordem parcial) antes de relançá-la.
+    template <typename Compare>
+    static void sortChain(Node<T>*& first, Compare& comp) {
+        // bins[i]: sequência ordenada com 2^i nós (ou vazia); bins mais
+        // altos guardam nós que vieram antes na cadeia
+        const int MaxBins = 64;
+        Node<T>* bins[MaxBins] = {};
+        int fill = 0;
+        Node<T>* rest = first;
+        Node<T>* carry = nullptr;
+        try {
+            while (rest != nullptr) {
+                carry = rest;
+                rest = rest->next;
+                carry->next = nullptr;
+                int i = 0;
+                for (; i < fill && bins[i] != nullptr; i++) {
+                    Node<T>* newer = carry;
+                    carry = nullptr;
+                    mergeChains(bins[i], newer, comp);
+                    carry = bins[i];
+                    bins[i] = nullptr;
+                }
+                bins[i] = carry;
+                carry = nullptr;
+                if (i == fill)
+                    fill++;
+            }
+            for (int i = 0; i < fill; i++) {
+                if (bins[i] == nullptr)
+                    continue;
+                Node<T>* newer = carry;
+                carry = nullptr;
+                mergeChains(bins[i], newer, comp);
+                carry = bins[i];
+                bins[i] = nullptr;
+            }
+        } catch (...) {
+            // Junta todas as sequências para que nenhum nó se perca
+            for (int i = 0; i < fill; i++)
+                appendChain(carry, bins[i]);
+            appendChain(carry, rest);
+            first = carry;
+            throw;
+        }
+        first = carry;
+    }
+
+    // Método auxiliar para anexar a cadeia 'chain' (ligada por next) ao
+    // final da cadeia 'first'.
+    static void appendChain(Node<T>*& first, Node<T>* chain) {
+        Node<T>** link = &first;
+        while (*link != nullptr)
+            link = &(*link)->next;
+        *link = chain;
+    }
+
+    // Método auxiliar para refazer os ponteiros prev, head e tail a partir
+    // da cadeia 'first' ligada apenas por next.
+    void relinkChain(Node<T>* first) {
+        cursor.reset();
+        head = first;
+        Node<T>* prev = nullptr;
+        for (Node<T>* current = first; current != nullptr; current = current->next) {
+            current->prev = prev;
+            prev = current;
+        }
+        tail = prev;
+        if (head != nullptr)
+            valueIndex.linked(head, tail, size);
+    }
+
+    // Método auxiliar para localizar o primeiro nó maior que 'value'
+    // (nullptr para o final). Os iguais ficam antes, mantendo a
+    // estabilidade. Compara primeiro com o tail: entradas em ordem
+    // crescente são anexadas em O(1).
+    template <typename Compare>
+    Node<T>* upperBound(const T& value, Compare& comp) const {
+        if (tail == nullptr || !comp(value, tail->data))
+            return nullptr;
+        int steps = 0;
+        Node<T>* current = head;
+        while (!comp(value, current->data)) {
+            current = current->next;
+            steps++;
+        }
+        metrics.traversed(steps);
+        return current;
+    }
+
+    // Método auxiliar para inserir um novo nó com 'value' à direita ('d')
+    // ou à esquerda ('r') de refNode.
+    void insertBeside(Node<T>* refNode, const T& value, char side) {
+        if (side == 'd') {
+            // Inserir à direita: antes do sucessor do nó de referência
+            linkNodeBefore(createNode(value), refNode->next);
+        } else if (side == 'r') {
+            // Inserir à esquerda: antes do nó de referência
+            linkNodeBefore(createNode(value), refNode);
         } else {
-            node->prev->next = node->next;
-            if (node->next != nullptr)
-                node->next->prev = node->prev;
+            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
         }
-        delete node;
-        size--;
     }
 
     // Método auxiliar para inserir um nó já criado em uma posição específica.
@@ -96,70 +1291,211 @@ private:
     void insertNodeAt(Node<T>* node, int index) {
         if (index < 0 || index > size)
             throw out_of_range("Índice fora dos limites da lista.");
-        if (index == 0) { // Inserção no início
-            node->next = head;
-            node->prev = nullptr;
-            if (head != nullptr)
-                head->prev = node;
-            head = node;
-        } else {
-            // Insere o nó antes do nó atualmente na posição 'index'
-            Node<T>* refNode = getNodeAt(index);
-            node->prev = refNode->prev;
-            node->next = refNode;
-            refNode->prev->next = node;
-            refNode->prev = node;
-        }
-        size++;
+        // Inserir em 'size' equivale a anexar ao final (refNode nulo)
+        Node<T>* refNode = (index == size) ? nullptr : getNodeAt(index);
+        linkNodeBefore(node, refNode);
+        cursor.set(node, index);
     }
 
 public:
+    /*---------------------------------------------------------------
+     * Classe BasicIterator
+     * Descrição: Iterador bidirecional sobre os nós da lista, usado em
+     *            range-for e nos algoritmos de <algorithm>.
+     *            IsConst seleciona a versão somente leitura. O iterador
+     *            end() guarda um nó nulo e a lista de origem, para que
+     *            --end() alcance o último nó (tail).
+     *---------------------------------------------------------------*/
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        typedef bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef typename conditional<IsConst, const T*, T*>::type pointer;
+        typedef typename conditional<IsConst, const T&, T&>::type reference;
+
+        BasicIterator() : node(nullptr), list(nullptr) {}
+
+        // Conversão implícita de iterator para const_iterator
+        template <bool OtherConst>
+        BasicIterator(const BasicIterator<OtherConst>& other,
+                      typename enable_if<IsConst && !OtherConst>::type* = nullptr)
+            : node(other.node), list(other.list) {}
+
+        reference operator*() const { return node->data; }
+        pointer operator->() const { return &node->data; }
+
+        BasicIterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator copy(*this);
+            node = node->next;
+            return copy;
+        }
+
+        BasicIterator& operator--() {
+            node = (node == nullptr) ? list->tail : node->prev;
+            return *this;
+        }
+
+        BasicIterator operator--(int) {
+            BasicIterator copy(*this);
+            --(*this);
+            return copy;
+        }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) { return a.node == b.node; }
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) { return a.node != b.node; }
+
+    private:
+        friend class DoublyLinkedList;
+        template <bool> friend class BasicIterator;
+
+        Node<T>* node;                  // Nó atual (nullptr representa end())
+        const DoublyLinkedList* list;   // Lista percorrida
+
+        BasicIterator(Node<T>* n, const DoublyLinkedList* l) : node(n), list(l) {}
+    };
+
+    typedef BasicIterator<false> iterator;
+    typedef BasicIterator<true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
     // Construtor da lista: inicializa uma lista vazia.
-    DoublyLinkedList() : head(nullptr), size(0) {}
+    DoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+
+    // Construtor a partir de um intervalo de iteradores [first, last).
+    template <typename InputIt>
+    DoublyLinkedList(InputIt first, InputIt last) : head(nullptr), tail(nullptr), size(0) {
+        pushRange(first, last);
+    }
 
-    // Destrutor: remove todos os nós e libera a memória.
+    // Construtor a partir de uma lista de inicialização: {1, 2, 3}.
+    DoublyLinkedList(initializer_list<T> values) : head(nullptr), tail(nullptr), size(0) {
+        pushRange(values.begin(), values.end());
+    }
+
+    // Construtor de cópia: cria uma nova lista com cópias de todos os
+    // elementos, usando uma instância própria da política de alocação.
+    DoublyLinkedList(const DoublyLinkedList& other) : head(nullptr), tail(nullptr), size(0) {
+        pushRange(other.begin(), other.end());
+    }
+
+    // Construtor de movimentação: assume os nós (e o alocador) de 'other',
+    // que fica vazia. Nenhum nó é copiado.
+    DoublyLinkedList(DoublyLinkedList&& other)
+        : allocator(std::move(other.allocator)), head(other.head), tail(other.tail), size(other.size) {
+        valueIndex.swap(other.valueIndex);
+        cursor.swap(other.cursor);
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.size = 0;
+    }
+
+    // Destrutor: libera todos os nós de uma só vez pela política de
+    // alocação. Não é uma chamada do usuário, por isso não abre Scope.
     ~DoublyLinkedList() {
-        while (head != nullptr) {
-            popFirst();
+        releaseAll();
+    }
+
+    // Atribuição por cópia (copy-and-swap).
+    DoublyLinkedList& operator=(const DoublyLinkedList& other) {
+        if (this != &other) {
+            DoublyLinkedList copy(other);
+            swap(copy);
         }
+        return *this;
+    }
+
+    // Atribuição por movimentação: os nós atuais são liberados e a lista
+    // assume os nós de 'other'.
+    DoublyLinkedList& operator=(DoublyLinkedList&& other) {
+        if (this != &other) {
+            DoublyLinkedList moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    /*---------------------------------------------------------------
+     * Função swap()
+     * Descrição: Troca o conteúdo (nós e alocador) com outra lista em O(1).
+     *---------------------------------------------------------------*/
+    void swap(DoublyLinkedList& other) {
+        allocator.swap(other.allocator);
+        valueIndex.swap(other.valueIndex);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(size, other.size);
+        cursor.swap(other.cursor);
     }
 
     /*---------------------------------------------------------------
      * Função push()
      * Descrição: Insere um novo elemento no final da lista.
      * Parâmetro:
-     *    - value: valor a ser inserido.
+     *    - value: valor a ser inserido (copiado ou movido).
      *---------------------------------------------------------------*/
     void push(const T& value) {
-        Node<T>* newNode = new Node<T>(value);
-        if (head == nullptr) {
-            head = newNode;
-        } else {
-            // Percorre até o último nó
-            Node<T>* current = head;
-            while (current->next != nullptr) {
-                current = current->next;
-            }
-            current->next = newNode;
-            newNode->prev = current;
-        }
-        size++;
+        emplace_back(value);
+    }
+
+    void push(T&& value) {
+        emplace_back(std::move(value));
     }
 
     /*---------------------------------------------------------------
      * Função pushFirst()
      * Descrição: Insere um novo elemento no início da lista.
      * Parâmetro:
-     *    - value: valor a ser inserido.
+     *    - value: valor a ser inserido (copiado ou movido).
      *---------------------------------------------------------------*/
     void pushFirst(const T& value) {
-        Node<T>* newNode = new Node<T>(value);
-        newNode->next = head;
-        newNode->prev = nullptr;
-        if (head != nullptr)
-            head->prev = newNode;
-        head = newNode;
-        size++;
+        emplace_front(value);
+    }
+
+    void pushFirst(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    /*---------------------------------------------------------------
+     * Funções emplace_back(), emplace_front() e emplace_at()
+     * Descrição: Constroem o elemento diretamente no nó, repassando
+     *            args ao construtor de T, sem cópia intermediária.
+     * Parâmetros:
+     *    - index (emplace_at): posição onde inserir (0 a size).
+     *    - args: argumentos do construtor de T.
+     *---------------------------------------------------------------*/
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Push);
+        // Anexa diretamente após o tail, sem percorrer a lista: O(1)
+        Node<T>* newNode = createNode(std::forward<Args>(args)...);
+        linkNodeBefore(newNode, nullptr);
+        return newNode->data;
+    }
+
+    template <typename... Args>
+    T& emplace_front(Args&&... args) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PushFirst);
+        Node<T>* newNode = createNode(std::forward<Args>(args)...);
+        linkNodeBefore(newNode, head);
+        return newNode->data;
+    }
+
+    template <typename... Args>
+    T& emplace_at(int index, Args&&... args) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::InsertAt);
+        if (index < 0 || index > size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        Node<T>* newNode = createNode(std::forward<Args>(args)...);
+        insertNodeAt(newNode, index);
+        return newNode->data;
     }
 
     /*---------------------------------------------------------------
@@ -171,18 +1507,12 @@ public:
      *    - side: 'd' para inserir à direita, 'r' para inserir à esquerda.
      *---------------------------------------------------------------*/
     void push(const T& refValue, char side) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PushBeside);
         Node<T>* refNode = getNodeByValue(refValue);
         if (refNode == nullptr)
             throw runtime_error("Valor de referência não encontrado na lista.");
-        // Obtém a posição do nó de referência
-        int idx = 0;
-        Node<T>* current = head;
-        while (current != nullptr && current != refNode) {
-            current = current->next;
-            idx++;
-        }
-        // Reaproveita a sobrecarga abaixo para inserir à direita ou à esquerda
-        push(idx, refValue, side);
+        // Insere diretamente ao lado do nó encontrado, sem recalcular o índice
+        insertBeside(refNode, refValue, side);
     }
 
     /*---------------------------------------------------------------
@@ -195,31 +1525,10 @@ public:
      *    - side: 'd' para inserir à direita, 'r' para inserir à esquerda.
      *---------------------------------------------------------------*/
     void push(int index, const T& value, char side) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PushBeside);
         if (index < 0 || index >= size)
             throw out_of_range("Índice fora dos limites da lista.");
-        Node<T>* refNode = getNodeAt(index);
-        Node<T>* newNode = new Node<T>(value);
-        if (side == 'd') {
-            // Inserir à direita: após o nó de referência
-            newNode->prev = refNode;
-            newNode->next = refNode->next;
-            if (refNode->next != nullptr)
-                refNode->next->prev = newNode;
-            refNode->next = newNode;
-        } else if (side == 'r') {
-            // Inserir à esquerda: antes do nó de referência
-            newNode->next = refNode;
-            newNode->prev = refNode->prev;
-            if (refNode->prev != nullptr)
-                refNode->prev->next = newNode;
-            refNode->prev = newNode;
-            if (refNode == head)
-                head = newNode;
-        } else {
-            delete newNode;
-            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
-        }
-        size++;
+        insertBeside(getNodeAt(index), value, side);
     }
 
     /*---------------------------------------------------------------
@@ -230,21 +1539,11 @@ public:
      *    - value: valor a ser inserido.
      *---------------------------------------------------------------*/
     void insertAt(int index, const T& value) {
-        if (index < 0 || index > size)
-            throw out_of_range("Índice fora dos limites da lista.");
-        if (index == 0) {
-            pushFirst(value);
-        } else if (index == size) {
-            push(value);
-        } else {
-            Node<T>* newNode = new Node<T>(value);
-            Node<T>* refNode = getNodeAt(index);
-            newNode->prev = refNode->prev;
-            newNode->next = refNode;
-            refNode->prev->next = newNode;
-            refNode->prev = newNode;
-            size++;
-        }
+        emplace_at(index, value);
+    }
+
+    void insertAt(int index, T&& value) {
+        emplace_at(index, std::move(value));
     }
 
     /*---------------------------------------------------------------
@@ -252,19 +1551,11 @@ public:
      * Descrição: Remove o último elemento da lista.
      *---------------------------------------------------------------*/
     void pop() {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Pop);
         if (size == 0)
             throw underflow_error("Lista vazia. Não há elementos para remover.");
-        if (size == 1) {
-            delete head;
-            head = nullptr;
-        } else {
-            Node<T>* current = head;
-            while (current->next != nullptr)
-                current = current->next;
-            current->prev->next = nullptr;
-            delete current;
-        }
-        size--;
+        // O último nó é acessado diretamente pelo tail: O(1)
+        removeNode(tail);
     }
 
     /*---------------------------------------------------------------
@@ -272,14 +1563,10 @@ public:
      * Descrição: Remove o primeiro elemento da lista.
      *---------------------------------------------------------------*/
     void popFirst() {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopFirst);
         if (head == nullptr)
             throw underflow_error("Lista vazia. Não há elementos para remover.");
-        Node<T>* temp = head;
-        head = head->next;
-        if (head != nullptr)
-            head->prev = nullptr;
-        delete temp;
-        size--;
+        removeNode(head);
     }
 
     /*---------------------------------------------------------------
@@ -289,6 +1576,7 @@ public:
      *    - value: valor que será buscado para remoção.
      *---------------------------------------------------------------*/
     void popByValue(const T& value) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopByValue);
         Node<T>* node = getNodeByValue(value);
         if (node == nullptr)
             throw runtime_error("Valor não encontrado na lista.");
@@ -301,6 +1589,7 @@ public:
      *            que contenha o valor especificado.
      *---------------------------------------------------------------*/
     void popByValue(const T& value, char side) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopBeside);
         Node<T>* refNode = getNodeByValue(value);
         if (refNode == nullptr)
             throw runtime_error("Valor de referência não encontrado na lista.");
@@ -323,6 +1612,7 @@ public:
      *            na posição index.
      *---------------------------------------------------------------*/
     void pop(int index, char side) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopBeside);
         if (size < 2)
             throw runtime_error("Não é possível remover nó adjacente em uma lista com um único elemento.");
         Node<T>* refNode = getNodeAt(index);
@@ -342,14 +1632,16 @@ public:
     /*---------------------------------------------------------------
      * Função popAt()
      * Descrição: Remove o nó na posição especificada e retorna seu valor.
+     *            O valor é movido para fora do nó antes da liberação.
      * Parâmetro:
      *    - index: posição do nó a ser removido.
      * Retorno:
      *    - valor do nó removido.
      *---------------------------------------------------------------*/
     T popAt(int index) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PopAt);
         Node<T>* node = getNodeAt(index);
-        T value = node->data;
+        T value(std::move(node->data));
         removeNode(node);
         return value;
     }
@@ -360,6 +1652,7 @@ public:
      *            dentro da mesma lista.
      *---------------------------------------------------------------*/
     void move(int index, int newIndex) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Move);
         if (index < 0 || index >= size)
             throw out_of_range("Índice original fora dos limites da lista.");
         if (newIndex < 0 || newIndex > size - 1)
@@ -369,36 +1662,14 @@ public:
         // Obtém o nó que será movido
         Node<T>* movingNode = getNodeAt(index);
         // Desanexa o nó da lista (sem deletar)
-        if (movingNode == head) {
-            head = movingNode->next;
-            if (head != nullptr)
-                head->prev = nullptr;
-        } else {
-            movingNode->prev->next = movingNode->next;
-            if (movingNode->next != nullptr)
-                movingNode->next->prev = movingNode->prev;
-        }
-        size--; // Ajusta o tamanho temporariamente
+        unlinkNode(movingNode); // Ajusta o tamanho temporariamente
 
         // Se o nó removido estava antes da nova posição, ajusta newIndex
         if (index < newIndex)
             newIndex--;
 
-        // Reinsere o nó na nova posição
-        if (newIndex == 0) {
-            movingNode->next = head;
-            movingNode->prev = nullptr;
-            if (head != nullptr)
-                head->prev = movingNode;
-            head = movingNode;
-        } else {
-            Node<T>* refNode = getNodeAt(newIndex);
-            movingNode->prev = refNode->prev;
-            movingNode->next = refNode;
-            refNode->prev->next = movingNode;
-            refNode->prev = movingNode;
-        }
-        size++;
+        // Reinsere o nó na nova posição (restaura o tamanho)
+        insertNodeAt(movingNode, newIndex);
     }
 
     /*---------------------------------------------------------------
@@ -407,15 +1678,30 @@ public:
      *            e escrita.
      *---------------------------------------------------------------*/
     T& operator[](int index) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Get);
+        Node<T>* node = getNodeAt(index);
+        return node->data;
+    }
+
+    const T& operator[](int index) const {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Get);
         Node<T>* node = getNodeAt(index);
         return node->data;
     }
 
     /*---------------------------------------------------------------
      * Função get()
-     * Descrição: Retorna o valor do elemento na posição especificada.
+     * Descrição: Retorna uma referência ao elemento na posição
+     *            especificada (somente leitura na versão const).
      *---------------------------------------------------------------*/
-    T get(int index) const {
+    T& get(int index) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Get);
+        Node<T>* node = getNodeAt(index);
+        return node->data;
+    }
+
+    const T& get(int index) const {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Get);
         Node<T>* node = getNodeAt(index);
         return node->data;
     }
@@ -425,8 +1711,261 @@ public:
      * Descrição: Define o valor do elemento na posição especificada.
      *---------------------------------------------------------------*/
     void set(int index, const T& value) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Set);
         Node<T>* node = getNodeAt(index);
+        valueIndex.erase(node);
         node->data = value;
+        valueIndex.insert(node);
+        valueIndex.linked(node, node, 1);
+    }
+
+    void set(int index, T&& value) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Set);
+        Node<T>* node = getNodeAt(index);
+        valueIndex.erase(node);
+        node->data = std::move(value);
+        valueIndex.insert(node);
+        valueIndex.linked(node, node, 1);
+    }
+
+    /*---------------------------------------------------------------
+     * Função pushRange()
+     * Descrição: Insere no final da lista cópias dos valores do
+     *            intervalo [first, last). A cadeia de nós é montada em
+     *            uma passada e anexada ao tail de uma só vez.
+     * Retorno:
+     *    - quantidade de elementos inseridos.
+     *---------------------------------------------------------------*/
+    template <typename InputIt>
+    int pushRange(InputIt first, InputIt last) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::PushRange);
+        Node<T>* chainFirst;
+        Node<T>* chainLast;
+        int count = buildChain(first, last, chainFirst, chainLast);
+        if (count > 0)
+            linkRangeBefore(chainFirst, chainLast, count, nullptr);
+        return count;
+    }
+
+    /*---------------------------------------------------------------
+     * Função insertRange()
+     * Descrição: Insere cópias dos valores de [first, last) a partir da
+     *            posição index. A posição é localizada uma única vez e
+     *            a cadeia inteira é religada de uma vez.
+     * Parâmetros:
+     *    - index: posição do primeiro valor inserido (0 a size).
+     *    - first, last: intervalo de valores.
+     * Retorno:
+     *    - quantidade de elementos inseridos.
+     *---------------------------------------------------------------*/
+    template <typename InputIt>
+    int insertRange(int index, InputIt first, InputIt last) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::InsertRange);
+        if (index < 0 || index > size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        Node<T>* refNode = (index == size) ? nullptr : getNodeAt(index);
+        Node<T>* chainFirst;
+        Node<T>* chainLast;
+        int count = buildChain(first, last, chainFirst, chainLast);
+        if (count > 0)
+            linkRangeBefore(chainFirst, chainLast, count, refNode);
+        return count;
+    }
+
+    /*---------------------------------------------------------------
+     * Função removeIf()
+     * Descrição: Remove, em uma única passada, todos os nós cujo valor
+     *            satisfaz o predicado.
+     * Retorno:
+     *    - quantidade de elementos removidos.
+     *---------------------------------------------------------------*/
+    template <typename Predicate>
+    int removeIf(Predicate pred) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::RemoveIf);
+        int removed = 0;
+        metrics.traversed(size);
+        Node<T>* current = head;
+        while (current != nullptr) {
+            Node<T>* next = current->next;
+            if (pred(current->data)) {
+                removeNode(current);
+                removed++;
+            }
+            current = next;
+        }
+        return removed;
+    }
+
+    /*---------------------------------------------------------------
+     * Função removeAll()
+     * Descrição: Remove, em uma única passada, todos os nós iguais a
+     *            'value'. Se 'value' for uma referência a um elemento da
+     *            própria lista, esse nó é liberado por último.
+     * Retorno:
+     *    - quantidade de elementos removidos.
+     *---------------------------------------------------------------*/
+    int removeAll(const T& value) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::RemoveIf);
+        int removed = 0;
+        Node<T>* deferred = nullptr;
+        metrics.traversed(size);
+        Node<T>* current = head;
+        while (current != nullptr) {
+            Node<T>* next = current->next;
+            if (current->data == value) {
+                if (&current->data == &value)
+                    deferred = current;
+                else
+                    removeNode(current);
+                removed++;
+            }
+            current = next;
+        }
+        if (deferred != nullptr)
+            removeNode(deferred);
+        return removed;
+    }
+
+    /*---------------------------------------------------------------
+     * Função clear()
+     * Descrição: Remove todos os elementos, liberando a cadeia inteira
+     *            de uma vez pela política de alocação.
+     *---------------------------------------------------------------*/
+    void clear() {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Clear);
+        releaseAll();
+    }
+
+    /*---------------------------------------------------------------
+     * Função sort()
+     * Descrição: Ordena a lista de forma estável (merge sort de baixo
+     *            para cima) apenas religando os nós: nenhum valor é
+     *            copiado ou movido e os iteradores continuam válidos.
+     *            O(n log n) comparações e O(1) de memória extra.
+     *            Se comp lançar exceção, a lista mantém todos os
+     *            elementos, em ordem parcial.
+     * Parâmetro:
+     *    - comp: comparação "menor que" (padrão: operator<).
+     *---------------------------------------------------------------*/
+    void sort() {
+        sort(less<T>());
+    }
+
+    template <typename Compare>
+    void sort(Compare comp) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Sort);
+        if (size < 2)
+            return;
+        Node<T>* chain = head;
+        try {
+            sortChain(chain, comp);
+        } catch (...) {
+            relinkChain(chain);
+            throw;
+        }
+        relinkChain(chain);
+    }
+
+    /*---------------------------------------------------------------
+     * Função merge()
+     * Descrição: Intercala em O(n + m) a lista ordenada 'other' nesta
+     *            lista (também ordenada), religando os nós como em
+     *            deslocate. Estável: em empate os elementos desta lista
+     *            vêm primeiro. 'other' fica vazia; merge(*this) não altera
+     *            a lista. Com alocadores que não permitem trocar nós entre
+     *            listas (pool e arena), os valores de 'other' são movidos
+     *            para nós desta lista.
+     * Parâmetros:
+     *    - other: lista ordenada pelo mesmo critério.
+     *    - comp: comparação "menor que" (padrão: operator<).
+     *---------------------------------------------------------------*/
+    void merge(DoublyLinkedList& other) {
+        merge(other, less<T>());
+    }
+
+    template <typename Compare>
+    void merge(DoublyLinkedList& other, Compare comp) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Merge);
+        typename Instrumentation::Scope otherScope(other.metrics, ListOperation::Merge);
+        if (&other == this || other.size == 0)
+            return;
+        Node<T>* first = other.head;
+        Node<T>* last = other.tail;
+        int count = other.size;
+        other.unlinkRange(first, last, count);
+        adoptRange(other, first, last, count, nullptr);
+        metrics.traversed(size + count);
+        Node<T>* chain = head;
+        size += count;
+        try {
+            mergeChains(chain, first, comp);
+        } catch (...) {
+            relinkChain(chain);
+            throw;
+        }
+        relinkChain(chain);
+    }
+
+    /*---------------------------------------------------------------
+     * Função insertSorted()
+     * Descrição: Insere 'value' em uma lista ordenada, depois dos
+     *            elementos iguais a ele (modo de inserção ordenada).
+     * Parâmetros:
+     *    - value: valor a ser inserido (copiado ou movido).
+     *    - comp: comparação "menor que" (padrão: operator<).
+     *---------------------------------------------------------------*/
+    void insertSorted(const T& value) {
+        insertSorted(value, less<T>());
+    }
+
+    void insertSorted(T&& value) {
+        insertSorted(std::move(value), less<T>());
+    }
+
+    template <typename Compare>
+    void insertSorted(const T& value, Compare comp) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::InsertSorted);
+        Node<T>* refNode = upperBound(value, comp);
+        linkNodeBefore(createNode(value), refNode);
+    }
+
+    template <typename Compare>
+    void insertSorted(T&& value, Compare comp) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::InsertSorted);
+        Node<T>* refNode = upperBound(value, comp);
+        linkNodeBefore(createNode(std::move(value)), refNode);
+    }
+
+    /*---------------------------------------------------------------
+     * Função unique()
+     * Descrição: Remove, em uma única passada, os elementos iguais ao
+     *            elemento mantido imediatamente antes deles (em uma lista
+     *            ordenada, remove todas as duplicatas).
+     * Parâmetro:
+     *    - equal: predicado de igualdade (padrão: operator==).
+     * Retorno:
+     *    - quantidade de elementos removidos.
+     *---------------------------------------------------------------*/
+    int unique() {
+        return unique(equal_to<T>());
+    }
+
+    template <typename BinaryPredicate>
+    int unique(BinaryPredicate equal) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Unique);
+        metrics.traversed(size);
+        int removed = 0;
+        Node<T>* kept = head;
+        while (kept != nullptr && kept->next != nullptr) {
+            Node<T>* current = kept->next;
+            if (equal(kept->data, current->data)) {
+                removeNode(current);
+                removed++;
+            } else {
+                kept = current;
+            }
+        }
+        return removed;
     }
 
     /*---------------------------------------------------------------
@@ -437,6 +1976,19 @@ public:
         return size;
     }
 
+    /*---------------------------------------------------------------
+     * Função instrumentation()
+     * Descrição: Acesso à política de métricas da lista. Com
+     *            CountingInstrumentation oferece snapshot() e reset().
+     *---------------------------------------------------------------*/
+    Instrumentation& instrumentation() {
+        return metrics;
+    }
+
+    const Instrumentation& instrumentation() const {
+        return metrics;
+    }
+
     /*---------------------------------------------------------------
      * Função print()
      * Descrição: Imprime o elemento na posição especificada.
@@ -469,24 +2021,136 @@ public:
         }
         cout << endl;
     }
+
+    /*---------------------------------------------------------------
+     * Funções begin(), end(), rbegin(), rend() e variantes const
+     * Descrição: Retornam iteradores para percorrer a lista em O(1)
+     *            por passo, nos dois sentidos.
+     *---------------------------------------------------------------*/
+    iterator begin() { return iterator(head, this); }
+    iterator end() { return iterator(nullptr, this); }
+    const_iterator begin() const { return const_iterator(head, this); }
+    const_iterator end() const { return const_iterator(nullptr, this); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    /*---------------------------------------------------------------
+     * Função insert(pos, value)
+     * Descrição: Insere um novo nó com 'value' antes da posição 'pos'
+     *            em O(1), sem busca por índice.
+     * Retorno:
+     *    - iterador para o nó inserido.
+     *---------------------------------------------------------------*/
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Insert);
+        Node<T>* newNode = createNode(std::forward<Args>(args)...);
+        linkNodeBefore(newNode, pos.node);
+        return iterator(newNode, this);
+    }
+
+    /*---------------------------------------------------------------
+     * Função erase(pos)
+     * Descrição: Remove o nó apontado por 'pos' em O(1).
+     * Retorno:
+     *    - iterador para o nó seguinte ao removido.
+     *---------------------------------------------------------------*/
+    iterator erase(const_iterator pos) {
+        typename Instrumentation::Scope scope(metrics, ListOperation::Erase);
+        if (pos.node == nullptr)
+            throw runtime_error("Operação inválida: nó nulo.");
+        Node<T>* next = pos.node->next;
+        removeNode(pos.node);
+        return iterator(next, this);
+    }
 };
 
 /*---------------------------------------------------------------
  * Função template deslocate()
  * Descrição: Desloca o nó do índice 'index' da lista 'source'
  *            para a posição 'newIndex' na lista 'dest'.
+ *            O próprio nó é religado na lista de destino, sem alocação
+ *            nem cópia do dado (exceto quando a política de alocação
+ *            não permite trocar nós entre listas).
  * Parâmetros:
  *    - source: lista de origem.
  *    - dest: lista de destino.
  *    - index: posição do nó a ser removido na lista de origem.
- *    - newIndex: posição onde o nó será inserido na lista de destino.
+ *    - newIndex: posição onde o nó será inserido na lista de destino
+ *                (considerando a lista já sem o nó, se source == dest).
  *---------------------------------------------------------------*/
-template <typename T>
-void deslocate(DoublyLinkedList<T>& source, DoublyLinkedList<T>& dest, int index, int newIndex) {
-    // Remove o nó da lista de origem e captura seu valor
-    T data = source.popAt(index);
-    // Insere o valor na lista de destino na posição especificada
-    dest.insertAt(newIndex, data);
+template <typename T, typename Allocator, typename ValueIndex, typename Instrumentation>
+void deslocate(DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& source,
+               DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& dest, int index, int newIndex) {
+    // A operação é registrada nas duas listas envolvidas
+    typename Instrumentation::Scope sourceScope(source.metrics, ListOperation::Deslocate);
+    typename Instrumentation::Scope destScope(dest.metrics, ListOperation::Deslocate);
+    Node<T>* node = source.getNodeAt(index);
+    // Valida o destino antes de desanexar, para não perder o nó
+    int destSize = (&source == &dest) ? dest.size - 1 : dest.size;
+    if (newIndex < 0 || newIndex > destSize)
+        throw out_of_range("Índice fora dos limites da lista.");
+    // Desanexa o nó da lista de origem (sem deletar)
+    Node<T>* sourceRef = node->next;
+    source.unlinkNode(node);
+    Node<T>* last = node;
+    dest.adoptRange(source, node, last, 1, sourceRef);
+    // Religa o nó na lista de destino na posição especificada
+    dest.insertNodeAt(node, newIndex);
+}
+
+/*---------------------------------------------------------------
+ * Função template splice()
+ * Descrição: Move os nós das posições [first, last) da lista 'source'
+ *            para antes da posição 'pos' da lista 'dest'. O intervalo é
+ *            desanexado e religado de uma vez: além de localizar as
+ *            extremidades, o custo é O(1). Funciona também dentro de
+ *            uma mesma lista (source == dest).
+ * Parâmetros:
+ *    - dest: lista de destino.
+ *    - pos: posição de destino, considerada antes da remoção do
+ *           intervalo (0 a dest.length()).
+ *    - source: lista de origem.
+ *    - first: posição do primeiro nó do intervalo.
+ *    - last: posição seguinte ao último nó do intervalo.
+ *---------------------------------------------------------------*/
+template <typename T, typename Allocator, typename ValueIndex, typename Instrumentation>
+void splice(DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& dest, int pos,
+            DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& source, int first, int last) {
+    typename Instrumentation::Scope destScope(dest.metrics, ListOperation::Splice);
+    typename Instrumentation::Scope sourceScope(source.metrics, ListOperation::Splice);
+    if (first < 0 || last > source.size || first > last)
+        throw out_of_range("Intervalo fora dos limites da lista.");
+    if (pos < 0 || pos > dest.size)
+        throw out_of_range("Índice fora dos limites da lista.");
+    bool sameList = (&source == &dest);
+    if (sameList && pos > first && pos < last)
+        throw invalid_argument("Posição de destino dentro do intervalo a ser movido.");
+    int count = last - first;
+    if (count == 0 || (sameList && (pos == first || pos == last)))
+        return; // Sem alteração
+    // Localiza o nó de referência antes de desanexar o intervalo
+    Node<T>* refNode = (pos == dest.size) ? nullptr : dest.getNodeAt(pos);
+    Node<T>* firstNode = source.getNodeAt(first);
+    Node<T>* lastNode = source.getNodeAt(last - 1);
+    Node<T>* sourceRef = lastNode->next;
+    source.unlinkRange(firstNode, lastNode, count);
+    dest.adoptRange(source, firstNode, lastNode, count, sourceRef);
+    dest.linkRangeBefore(firstNode, lastNode, count, refNode);
 }
 
 #endif // DOUBLY_LINKED_LIST_H
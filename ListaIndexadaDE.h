@@ -0,0 +1,491 @@
+#ifndef INDEXED_DOUBLY_LINKED_LIST_H
+#define INDEXED_DOUBLY_LINKED_LIST_H
+
+#include "ListaGenericaDE.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*
+Descrição:
+Modo de estatística de ordem da lista duplamente encadeada. Sobre os
+ponteiros prev/next de cada nó (nível 0) é mantida uma skip list
+indexável: alguns nós recebem níveis extras com ponteiros de avanço e a
+quantidade de posições que cada ponteiro salta (span). Localizar o
+índice i custa O(log n) esperado, e por consequência operator[], get,
+set, insertAt, popAt, move e pop(index, side) também.
+*/
+
+/*---------------------------------------------------------------
+ * Template da estrutura IndexedNode
+ * Descrição: Nó da lista indexada.
+ * Glossário:
+ *    - data: armazena o valor do nó.
+ *    - next/prev: encadeamento duplo de nível 0 (todos os nós).
+ *    - links: níveis superiores (1..nível-1); links[l - 1] guarda o
+ *             próximo nó no nível l e quantas posições ele salta.
+ *---------------------------------------------------------------*/
+template <typename T>
+struct IndexedNode {
+    struct Link {
+        IndexedNode* next;   // Próximo nó neste nível
+        int width;           // Posições saltadas até ele
+    };
+
+    T data;
+    IndexedNode* next;
+    IndexedNode* prev;
+    vector<Link> links;
+
+    IndexedNode(const T& value, int level)
+        : data(value), next(nullptr), prev(nullptr), links(level - 1) {}
+
+    int level() const {
+        return static_cast<int>(links.size()) + 1;
+    }
+};
+
+/*---------------------------------------------------------------
+ * Classe IndexedDoublyLinkedList
+ * Descrição: Lista duplamente encadeada com acesso posicional em
+ *            O(log n) esperado. O nível de cada nó é sorteado na
+ *            criação (probabilidade 1/4 de subir cada nível) e mantido
+ *            quando o nó é movido.
+ *---------------------------------------------------------------*/
+template <typename T>
+class IndexedDoublyLinkedList {
+private:
+    typedef IndexedNode<T> Node;
+    typedef typename Node::Link Link;
+
+    static const int MaxLevel = 16;   // Suficiente para ~4^16 elementos
+
+    Link headLinks[MaxLevel];   // Níveis superiores da cabeça (posição -1)
+    Node* head;                 // Primeiro nó (nível 0)
+    Node* tail;                 // Último nó (nível 0)
+    int size;                   // Número de elementos presentes na lista
+    int levels;                 // Níveis em uso (1 = só o encadeamento base)
+    uint32_t seed;              // Estado do gerador de níveis (xorshift)
+
+    IndexedDoublyLinkedList(const IndexedDoublyLinkedList&);
+    IndexedDoublyLinkedList& operator=(const IndexedDoublyLinkedList&);
+
+    // Link do nível l (l >= 1) a partir de x; x nulo representa a cabeça.
+    Link& linkOf(Node* x, int l) {
+        return (x == nullptr) ? headLinks[l] : x->links[l - 1];
+    }
+
+    // Sorteia o nível de um novo nó.
+    int randomLevel() {
+        int level = 1;
+        for (;;) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            if ((seed & 3) != 0 || level == MaxLevel)
+                return level;
+            level++;
+        }
+    }
+
+    // Método auxiliar para localizar os predecessores da posição index.
+    // Em cada nível l >= 1, update[l] recebe o último nó com posição menor
+    // que index (nulo = cabeça) e updatePos[l] a sua posição. Retorna o
+    // nó que precede index no nível 0 (nulo se index == 0).
+    Node* findPredecessors(int index, Node** update, int* updatePos) {
+        Node* x = nullptr;
+        int pos = -1;
+        for (int l = levels - 1; l >= 1; l--) {
+            for (;;) {
+                Link& link = linkOf(x, l);
+                if (link.next == nullptr || pos + link.width >= index)
+                    break;
+                pos += link.width;
+                x = link.next;
+            }
+            update[l] = x;
+            updatePos[l] = pos;
+        }
+        // Completa o percurso no nível 0
+        while (pos + 1 < index) {
+            x = (x == nullptr) ? head : x->next;
+            pos++;
+        }
+        return x;
+    }
+
+    // Método auxiliar para obter o nó na posição index em O(log n).
+    // Lança exceção se o índice estiver fora dos limites.
+    Node* getNodeAt(int index) const {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        Node* x = nullptr;
+        int pos = -1;
+        for (int l = levels - 1; l >= 1; l--) {
+            for (;;) {
+                const Link& link = (x == nullptr) ? headLinks[l] : x->links[l - 1];
+                if (link.next == nullptr || pos + link.width > index)
+                    break;
+                pos += link.width;
+                x = link.next;
+            }
+        }
+        while (pos < index) {
+            x = (x == nullptr) ? head : x->next;
+            pos++;
+        }
+        return x;
+    }
+
+    // Método auxiliar para encadear um nó já criado na posição index,
+    // mantendo o nível do nó. Não valida o índice.
+    void linkAt(Node* node, int index) {
+        Node* update[MaxLevel];
+        int updatePos[MaxLevel];
+        int level = node->level();
+        for (int l = levels; l < level; l++) {
+            // Níveis novos começam pela cabeça, sem sucessor
+            headLinks[l].next = nullptr;
+            headLinks[l].width = 0;
+        }
+        Node* pred = findPredecessors(index, update, updatePos);
+        for (int l = levels; l < level; l++) {
+            update[l] = nullptr;
+            updatePos[l] = -1;
+        }
+        if (level > levels)
+            levels = level;
+
+        for (int l = 1; l < levels; l++) {
+            Link& link = linkOf(update[l], l);
+            if (l < level) {
+                // O nó novo assume o trecho entre o predecessor e o sucessor
+                Link& own = node->links[l - 1];
+                own.next = link.next;
+                own.width = updatePos[l] + link.width + 1 - index;
+                link.next = node;
+                link.width = index - updatePos[l];
+            } else {
+                link.width++;   // O trecho que passa por cima do nó cresce
+            }
+        }
+
+        // Nível 0: encadeamento duplo tradicional
+        Node* succ = (pred == nullptr) ? head : pred->next;
+        node->prev = pred;
+        node->next = succ;
+        if (pred != nullptr)
+            pred->next = node;
+        else
+            head = node;
+        if (succ != nullptr)
+            succ->prev = node;
+        else
+            tail = node;
+        size++;
+    }
+
+    // Método auxiliar para desencadear (sem liberar) o nó da posição index.
+    // Não valida o índice.
+    Node* unlinkAt(int index) {
+        Node* update[MaxLevel];
+        int updatePos[MaxLevel];
+        Node* pred = findPredecessors(index, update, updatePos);
+        Node* node = (pred == nullptr) ? head : pred->next;
+
+        for (int l = 1; l < levels; l++) {
+            Link& link = linkOf(update[l], l);
+            if (link.next == node) {
+                Link& own = node->links[l - 1];
+                link.next = own.next;
+                link.width += own.width - 1;
+            } else {
+                link.width--;
+            }
+        }
+        while (levels > 1 && headLinks[levels - 1].next == nullptr)
+            levels--;
+
+        if (node->prev != nullptr)
+            node->prev->next = node->next;
+        else
+            head = node->next;
+        if (node->next != nullptr)
+            node->next->prev = node->prev;
+        else
+            tail = node->prev;
+        node->next = nullptr;
+        node->prev = nullptr;
+        size--;
+        return node;
+    }
+
+    // Método auxiliar para buscar a posição da primeira ocorrência de value.
+    // Retorna -1 se não encontrar.
+    int indexOfValue(const T& value) const {
+        int index = 0;
+        for (Node* current = head; current != nullptr; current = current->next, index++) {
+            if (current->data == value)
+                return index;
+        }
+        return -1;
+    }
+
+    // Remove o vizinho ('d' direita, 'r' esquerda) da posição index.
+    void removeBeside(int index, char side) {
+        if (side == 'd') {
+            if (index + 1 >= size)
+                throw runtime_error("Não há nó à direita para remover.");
+            delete unlinkAt(index + 1);
+        } else if (side == 'r') {
+            if (index == 0)
+                throw runtime_error("Não há nó à esquerda para remover.");
+            delete unlinkAt(index - 1);
+        } else {
+            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
+        }
+    }
+
+    template <typename U>
+    friend void deslocate(IndexedDoublyLinkedList<U>& source, IndexedDoublyLinkedList<U>& dest, int index, int newIndex);
+
+public:
+    // Construtor da lista: inicializa uma lista vazia.
+    IndexedDoublyLinkedList() : head(nullptr), tail(nullptr), size(0), levels(1), seed(2463534242u) {
+        for (int l = 0; l < MaxLevel; l++) {
+            headLinks[l].next = nullptr;
+            headLinks[l].width = 0;
+        }
+    }
+
+    // Destrutor: libera todos os nós seguindo o nível 0.
+    ~IndexedDoublyLinkedList() {
+        while (head != nullptr) {
+            Node* next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Funções push() e pushFirst()
+     * Descrição: Inserem um novo elemento no final / no início da lista.
+     *---------------------------------------------------------------*/
+    void push(const T& value) {
+        linkAt(new Node(value, randomLevel()), size);
+    }
+
+    void pushFirst(const T& value) {
+        linkAt(new Node(value, randomLevel()), 0);
+    }
+
+    /*---------------------------------------------------------------
+     * Função push(refValue, side)
+     * Descrição: Insere um novo nó à direita ('d') ou à esquerda ('r')
+     *            do primeiro nó que contenha refValue.
+     *---------------------------------------------------------------*/
+    void push(const T& refValue, char side) {
+        int idx = indexOfValue(refValue);
+        if (idx < 0)
+            throw runtime_error("Valor de referência não encontrado na lista.");
+        push(idx, refValue, side);
+    }
+
+    /*---------------------------------------------------------------
+     * Função push(index, value, side)
+     * Descrição: Insere um novo nó com 'value' à direita ('d') ou à
+     *            esquerda ('r') do nó na posição index.
+     *---------------------------------------------------------------*/
+    void push(int index, const T& value, char side) {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        if (side == 'd')
+            insertAt(index + 1, value);
+        else if (side == 'r')
+            insertAt(index, value);
+        else
+            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
+    }
+
+    /*---------------------------------------------------------------
+     * Função insertAt()
+     * Descrição: Insere um novo nó com 'value' na posição especificada.
+     * Parâmetro:
+     *    - index: posição onde inserir (0 para início, size para final).
+     *    - value: valor a ser inserido.
+     *---------------------------------------------------------------*/
+    void insertAt(int index, const T& value) {
+        if (index < 0 || index > size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        linkAt(new Node(value, randomLevel()), index);
+    }
+
+    /*---------------------------------------------------------------
+     * Funções pop() e popFirst()
+     * Descrição: Removem o último / o primeiro elemento da lista.
+     *---------------------------------------------------------------*/
+    void pop() {
+        if (size == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        delete unlinkAt(size - 1);
+    }
+
+    void popFirst() {
+        if (size == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        delete unlinkAt(0);
+    }
+
+    /*---------------------------------------------------------------
+     * Função popByValue()
+     * Descrição: Remove o primeiro nó que contenha o valor especificado.
+     *---------------------------------------------------------------*/
+    void popByValue(const T& value) {
+        int idx = indexOfValue(value);
+        if (idx < 0)
+            throw runtime_error("Valor não encontrado na lista.");
+        delete unlinkAt(idx);
+    }
+
+    /*---------------------------------------------------------------
+     * Função popByValue(value, side)
+     * Descrição: Remove o nó à direita ('d') ou à esquerda ('r') do nó
+     *            que contenha o valor especificado.
+     *---------------------------------------------------------------*/
+    void popByValue(const T& value, char side) {
+        int idx = indexOfValue(value);
+        if (idx < 0)
+            throw runtime_error("Valor de referência não encontrado na lista.");
+        removeBeside(idx, side);
+    }
+
+    /*---------------------------------------------------------------
+     * Função pop(index, side)
+     * Descrição: Remove o nó à direita ('d') ou à esquerda ('r') do nó
+     *            na posição index.
+     *---------------------------------------------------------------*/
+    void pop(int index, char side) {
+        if (size < 2)
+            throw runtime_error("Não é possível remover nó adjacente em uma lista com um único elemento.");
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        removeBeside(index, side);
+    }
+
+    /*---------------------------------------------------------------
+     * Função popAt()
+     * Descrição: Remove o nó na posição especificada e retorna seu valor.
+     *---------------------------------------------------------------*/
+    T popAt(int index) {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        Node* node = unlinkAt(index);
+        T value(std::move(node->data));
+        delete node;
+        return value;
+    }
+
+    /*---------------------------------------------------------------
+     * Função move()
+     * Descrição: Move o nó da posição 'index' para a nova posição
+     *            'newIndex' (mesma semântica da DoublyLinkedList::move).
+     *            O nó é reaproveitado, com o mesmo nível.
+     *---------------------------------------------------------------*/
+    void move(int index, int newIndex) {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice original fora dos limites da lista.");
+        if (newIndex < 0 || newIndex > size - 1)
+            throw out_of_range("Novo índice fora dos limites da lista.");
+        if (index == newIndex)
+            return; // Sem alteração
+        Node* movingNode = unlinkAt(index);
+        // Se o nó removido estava antes da nova posição, ajusta newIndex
+        if (index < newIndex)
+            newIndex--;
+        linkAt(movingNode, newIndex);
+    }
+
+    /*---------------------------------------------------------------
+     * Operador [], get() e set()
+     * Descrição: Acesso ao elemento pelo índice em O(log n).
+     *---------------------------------------------------------------*/
+    T& operator[](int index) {
+        return getNodeAt(index)->data;
+    }
+
+    const T& operator[](int index) const {
+        return getNodeAt(index)->data;
+    }
+
+    T& get(int index) {
+        return getNodeAt(index)->data;
+    }
+
+    const T& get(int index) const {
+        return getNodeAt(index)->data;
+    }
+
+    void set(int index, const T& value) {
+        getNodeAt(index)->data = value;
+    }
+
+    /*---------------------------------------------------------------
+     * Função length()
+     * Descrição: Retorna o número de elementos presentes na lista.
+     *---------------------------------------------------------------*/
+    int length() const {
+        return size;
+    }
+
+    /*---------------------------------------------------------------
+     * Função print()
+     * Descrição: Imprime o elemento na posição especificada.
+     *---------------------------------------------------------------*/
+    void print(int index) const {
+        try {
+            const T& value = get(index);
+            cout << "Elemento no índice " << index << ": " << value << endl;
+        } catch (const exception& e) {
+            cout << "Erro ao imprimir: " << e.what() << endl;
+        }
+    }
+
+    /*---------------------------------------------------------------
+     * Função printAll()
+     * Descrição: Imprime todos os elementos da lista.
+     *---------------------------------------------------------------*/
+    void printAll() const {
+        if (head == nullptr) {
+            cout << "Lista vazia." << endl;
+            return;
+        }
+        cout << "Elementos da lista: ";
+        for (Node* current = head; current != nullptr; current = current->next) {
+            cout << current->data;
+            if (current->next != nullptr)
+                cout << " -> ";
+        }
+        cout << endl;
+    }
+};
+
+/*---------------------------------------------------------------
+ * Função template deslocate() (lista indexada)
+ * Descrição: Desloca o nó do índice 'index' da lista 'source' para a
+ *            posição 'newIndex' na lista 'dest', religando o próprio nó
+ *            (com o mesmo nível) em O(log n).
+ *---------------------------------------------------------------*/
+template <typename T>
+void deslocate(IndexedDoublyLinkedList<T>& source, IndexedDoublyLinkedList<T>& dest, int index, int newIndex) {
+    if (index < 0 || index >= source.size)
+        throw out_of_range("Índice fora dos limites da lista.");
+    // Valida o destino antes de desanexar, para não perder o nó
+    int destSize = (&source == &dest) ? dest.size - 1 : dest.size;
+    if (newIndex < 0 || newIndex > destSize)
+        throw out_of_range("Índice fora dos limites da lista.");
+    typename IndexedDoublyLinkedList<T>::Node* node = source.unlinkAt(index);
+    dest.linkAt(node, newIndex);
+}
+
+#endif // INDEXED_DOUBLY_LINKED_LIST_H
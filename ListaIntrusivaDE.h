@@ -0,0 +1,425 @@
+#ifndef INTRUSIVE_DOUBLY_LINKED_LIST_H
+#define INTRUSIVE_DOUBLY_LINKED_LIST_H
+
+#include "ListaGenericaDE.h"
+
+#include <cstddef>
+#include <iterator>
+
+/*
+Descrição:
+Variante intrusiva da lista duplamente encadeada. O próprio objeto
+guarda os ponteiros prev/next em um gancho (IntrusiveHook) e a lista
+apenas liga e desliga objetos que já existem: nenhuma operação aloca
+memória, copia ou destrói os objetos. O dono do objeto (por exemplo, o
+pool da aplicação) continua responsável pela sua memória, e o objeto
+deve ser retirado da lista (erase, pop...) antes de ser destruído.
+A interface segue a da DoublyLinkedList (push, pushFirst, insertAt,
+popAt, move, operator[], deslocate, ...), recebendo e devolvendo
+referências aos objetos.
+*/
+
+/*---------------------------------------------------------------
+ * Template da estrutura IntrusiveHook
+ * Descrição: Gancho embutido em T para que o objeto possa pertencer a
+ *            uma lista intrusiva. Um objeto pode estar em várias listas
+ *            ao mesmo tempo se tiver um gancho para cada uma.
+ * Glossário:
+ *    - next/prev: vizinhos do objeto na lista.
+ *    - owner: lista que contém o objeto (nullptr se estiver livre).
+ *---------------------------------------------------------------*/
+template <typename T>
+struct IntrusiveHook {
+    T* next;
+    T* prev;
+    const void* owner;
+
+    IntrusiveHook() : next(nullptr), prev(nullptr), owner(nullptr) {}
+
+    // Copiar o objeto não copia a sua posição em listas
+    IntrusiveHook(const IntrusiveHook&) : next(nullptr), prev(nullptr), owner(nullptr) {}
+    IntrusiveHook& operator=(const IntrusiveHook&) { return *this; }
+
+    bool linked() const {
+        return owner != nullptr;
+    }
+};
+
+/*---------------------------------------------------------------
+ * Classe IntrusiveDoublyLinkedList
+ * Descrição: Lista duplamente encadeada de objetos com gancho embutido.
+ *            Todas as operações são livres de alocação; inserir, remover
+ *            e mover um objeto dado por referência custa O(1).
+ * Parâmetros do template:
+ *    - T: tipo dos objetos encadeados.
+ *    - Hook: membro de T usado como gancho (padrão: &T::hook).
+ *---------------------------------------------------------------*/
+template <typename T, IntrusiveHook<T> T::*Hook = &T::hook>
+class IntrusiveDoublyLinkedList {
+private:
+    T* head;   // Primeiro objeto da lista
+    T* tail;   // Último objeto da lista
+    int size;  // Número de objetos presentes na lista
+
+    IntrusiveDoublyLinkedList(const IntrusiveDoublyLinkedList&);
+    IntrusiveDoublyLinkedList& operator=(const IntrusiveDoublyLinkedList&);
+
+    template <typename U, IntrusiveHook<U> U::*H>
+    friend void deslocate(IntrusiveDoublyLinkedList<U, H>& source, IntrusiveDoublyLinkedList<U, H>& dest, int index, int newIndex);
+
+    static IntrusiveHook<T>& hookOf(T& object) {
+        return object.*Hook;
+    }
+
+    // Método auxiliar para obter o objeto na posição index, percorrendo a
+    // partir da extremidade mais próxima.
+    // Lança exceção se o índice estiver fora dos limites.
+    T* getObjectAt(int index) const {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        T* current;
+        if (index < size / 2) {
+            current = head;
+            for (int i = 0; i < index; i++)
+                current = hookOf(*current).next;
+        } else {
+            current = tail;
+            for (int i = size - 1; i > index; i--)
+                current = hookOf(*current).prev;
+        }
+        return current;
+    }
+
+    // Método auxiliar para ligar 'object' antes de refObject. Se refObject
+    // for nullptr, o objeto é ligado ao final da lista.
+    void linkBefore(T& object, T* refObject) {
+        IntrusiveHook<T>& hook = hookOf(object);
+        if (hook.linked())
+            throw invalid_argument("Objeto já pertence a uma lista.");
+        hook.next = refObject;
+        hook.prev = (refObject != nullptr) ? hookOf(*refObject).prev : tail;
+        if (hook.prev != nullptr)
+            hookOf(*hook.prev).next = &object;
+        else
+            head = &object;
+        if (refObject != nullptr)
+            hookOf(*refObject).prev = &object;
+        else
+            tail = &object;
+        hook.owner = this;
+        size++;
+    }
+
+    // Método auxiliar para desligar 'object' da lista, deixando o gancho
+    // livre.
+    void unlink(T& object) {
+        IntrusiveHook<T>& hook = hookOf(object);
+        if (hook.prev != nullptr)
+            hookOf(*hook.prev).next = hook.next;
+        else
+            head = hook.next;
+        if (hook.next != nullptr)
+            hookOf(*hook.next).prev = hook.prev;
+        else
+            tail = hook.prev;
+        hook.next = nullptr;
+        hook.prev = nullptr;
+        hook.owner = nullptr;
+        size--;
+    }
+
+    // Método auxiliar para ligar 'object' na posição index (0 a size).
+    void linkAt(T& object, int index) {
+        if (index < 0 || index > size)
+            throw out_of_range("Índice fora dos limites da lista.");
+        linkBefore(object, (index == size) ? nullptr : getObjectAt(index));
+    }
+
+public:
+    /*---------------------------------------------------------------
+     * Classe BasicIterator
+     * Descrição: Iterador bidirecional sobre os objetos da lista. O
+     *            iterador end() guarda um objeto nulo e a lista, para que
+     *            --end() alcance o último objeto.
+     *---------------------------------------------------------------*/
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        typedef bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef typename conditional<IsConst, const T*, T*>::type pointer;
+        typedef typename conditional<IsConst, const T&, T&>::type reference;
+
+        BasicIterator() : object(nullptr), list(nullptr) {}
+
+        template <bool OtherConst>
+        BasicIterator(const BasicIterator<OtherConst>& other,
+                      typename enable_if<IsConst && !OtherConst>::type* = nullptr)
+            : object(other.object), list(other.list) {}
+
+        reference operator*() const { return *object; }
+        pointer operator->() const { return object; }
+
+        BasicIterator& operator++() {
+            object = hookOf(*object).next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator copy(*this);
+            ++(*this);
+            return copy;
+        }
+
+        BasicIterator& operator--() {
+            object = (object == nullptr) ? list->tail : hookOf(*object).prev;
+            return *this;
+        }
+
+        BasicIterator operator--(int) {
+            BasicIterator copy(*this);
+            --(*this);
+            return copy;
+        }
+
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) { return a.object == b.object; }
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) { return a.object != b.object; }
+
+    private:
+        friend class IntrusiveDoublyLinkedList;
+        template <bool> friend class BasicIterator;
+
+        T* object;                                 // Objeto atual (nullptr representa end())
+        const IntrusiveDoublyLinkedList* list;     // Lista percorrida
+
+        BasicIterator(T* o, const IntrusiveDoublyLinkedList* l) : object(o), list(l) {}
+    };
+
+    typedef BasicIterator<false> iterator;
+    typedef BasicIterator<true> const_iterator;
+
+    // Construtor da lista: inicializa uma lista vazia.
+    IntrusiveDoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+
+    // Destrutor: desliga os objetos restantes (que não são destruídos).
+    ~IntrusiveDoublyLinkedList() {
+        clear();
+    }
+
+    /*---------------------------------------------------------------
+     * Função push()
+     * Descrição: Liga o objeto no final da lista.
+     *---------------------------------------------------------------*/
+    void push(T& object) {
+        linkBefore(object, nullptr);
+    }
+
+    /*---------------------------------------------------------------
+     * Função pushFirst()
+     * Descrição: Liga o objeto no início da lista.
+     *---------------------------------------------------------------*/
+    void pushFirst(T& object) {
+        linkBefore(object, head);
+    }
+
+    /*---------------------------------------------------------------
+     * Função push(refObject, object, side)
+     * Descrição: Liga o objeto à direita ('d') ou à esquerda ('r') de
+     *            refObject, que deve estar nesta lista. O(1).
+     *---------------------------------------------------------------*/
+    void push(T& refObject, T& object, char side) {
+        if (hookOf(refObject).owner != this)
+            throw invalid_argument("Objeto de referência não pertence a esta lista.");
+        if (side == 'd')
+            linkBefore(object, hookOf(refObject).next);
+        else if (side == 'r')
+            linkBefore(object, &refObject);
+        else
+            throw invalid_argument("Parâmetro 'side' inválido. Use 'd' para direita ou 'r' para esquerda.");
+    }
+
+    /*---------------------------------------------------------------
+     * Função insertAt()
+     * Descrição: Liga o objeto na posição especificada.
+     * Parâmetro:
+     *    - index: posição onde inserir (0 para início, size para final).
+     *    - object: objeto a ser ligado.
+     *---------------------------------------------------------------*/
+    void insertAt(int index, T& object) {
+        linkAt(object, index);
+    }
+
+    /*---------------------------------------------------------------
+     * Função pop()
+     * Descrição: Desliga e retorna o último objeto da lista.
+     *---------------------------------------------------------------*/
+    T& pop() {
+        if (size == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        T& object = *tail;
+        unlink(object);
+        return object;
+    }
+
+    /*---------------------------------------------------------------
+     * Função popFirst()
+     * Descrição: Desliga e retorna o primeiro objeto da lista.
+     *---------------------------------------------------------------*/
+    T& popFirst() {
+        if (size == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        T& object = *head;
+        unlink(object);
+        return object;
+    }
+
+    /*---------------------------------------------------------------
+     * Função popAt()
+     * Descrição: Desliga e retorna o objeto na posição especificada.
+     *---------------------------------------------------------------*/
+    T& popAt(int index) {
+        T& object = *getObjectAt(index);
+        unlink(object);
+        return object;
+    }
+
+    /*---------------------------------------------------------------
+     * Função erase()
+     * Descrição: Desliga o objeto da lista em O(1), sem busca.
+     *            Lança exceção se o objeto não pertencer a esta lista.
+     *---------------------------------------------------------------*/
+    void erase(T& object) {
+        if (hookOf(object).owner != this)
+            throw invalid_argument("Objeto não pertence a esta lista.");
+        unlink(object);
+    }
+
+    /*---------------------------------------------------------------
+     * Função move()
+     * Descrição: Move o objeto da posição 'index' para a nova posição
+     *            'newIndex' dentro da mesma lista (mesma semântica da
+     *            DoublyLinkedList::move).
+     *---------------------------------------------------------------*/
+    void move(int index, int newIndex) {
+        if (index < 0 || index >= size)
+            throw out_of_range("Índice original fora dos limites da lista.");
+        if (newIndex < 0 || newIndex > size - 1)
+            throw out_of_range("Novo índice fora dos limites da lista.");
+        if (index == newIndex)
+            return; // Sem alteração
+        T& object = *getObjectAt(index);
+        unlink(object);
+        // Se o objeto estava antes da nova posição, ajusta newIndex
+        if (index < newIndex)
+            newIndex--;
+        linkAt(object, newIndex);
+    }
+
+    /*---------------------------------------------------------------
+     * Função moveBefore()
+     * Descrição: Move 'object' para antes de 'refObject' (ou para o
+     *            final, se refObject for nullptr) em O(1). Os dois
+     *            objetos devem pertencer a esta lista.
+     *---------------------------------------------------------------*/
+    void moveBefore(T& object, T* refObject) {
+        if (hookOf(object).owner != this || (refObject != nullptr && hookOf(*refObject).owner != this))
+            throw invalid_argument("Objeto não pertence a esta lista.");
+        if (&object == refObject)
+            return; // Sem alteração
+        unlink(object);
+        linkBefore(object, refObject);
+    }
+
+    /*---------------------------------------------------------------
+     * Operador [] e função get()
+     * Descrição: Retornam uma referência ao objeto na posição
+     *            especificada.
+     *---------------------------------------------------------------*/
+    T& operator[](int index) {
+        return *getObjectAt(index);
+    }
+
+    const T& operator[](int index) const {
+        return *getObjectAt(index);
+    }
+
+    T& get(int index) {
+        return *getObjectAt(index);
+    }
+
+    const T& get(int index) const {
+        return *getObjectAt(index);
+    }
+
+    /*---------------------------------------------------------------
+     * Função contains()
+     * Descrição: Indica, em O(1), se o objeto pertence a esta lista.
+     *---------------------------------------------------------------*/
+    bool contains(const T& object) const {
+        return (object.*Hook).owner == this;
+    }
+
+    /*---------------------------------------------------------------
+     * Função clear()
+     * Descrição: Desliga todos os objetos (sem destruí-los).
+     *---------------------------------------------------------------*/
+    void clear() {
+        while (head != nullptr)
+            unlink(*head);
+    }
+
+    /*---------------------------------------------------------------
+     * Função length()
+     * Descrição: Retorna o número de objetos presentes na lista.
+     *---------------------------------------------------------------*/
+    int length() const {
+        return size;
+    }
+
+    /*---------------------------------------------------------------
+     * Função printAll()
+     * Descrição: Imprime todos os objetos da lista (requer operator<<).
+     *---------------------------------------------------------------*/
+    void printAll() const {
+        if (head == nullptr) {
+            cout << "Lista vazia." << endl;
+            return;
+        }
+        cout << "Elementos da lista: ";
+        for (T* current = head; current != nullptr; current = hookOf(*current).next) {
+            cout << *current;
+            if (hookOf(*current).next != nullptr)
+                cout << " -> ";
+        }
+        cout << endl;
+    }
+
+    /*---------------------------------------------------------------
+     * Funções begin() e end()
+     * Descrição: Iteradores bidirecionais sobre os objetos.
+     *---------------------------------------------------------------*/
+    iterator begin() { return iterator(head, this); }
+    iterator end() { return iterator(nullptr, this); }
+    const_iterator begin() const { return const_iterator(head, this); }
+    const_iterator end() const { return const_iterator(nullptr, this); }
+};
+
+/*---------------------------------------------------------------
+ * Função template deslocate() (lista intrusiva)
+ * Descrição: Desloca o objeto do índice 'index' da lista 'source'
+ *            para a posição 'newIndex' na lista 'dest', apenas
+ *            religando o gancho (sem alocação nem cópia).
+ *---------------------------------------------------------------*/
+template <typename T, IntrusiveHook<T> T::*Hook>
+void deslocate(IntrusiveDoublyLinkedList<T, Hook>& source, IntrusiveDoublyLinkedList<T, Hook>& dest, int index, int newIndex) {
+    T* object = source.getObjectAt(index);
+    // Valida o destino antes de desligar, para não perder o objeto
+    int destSize = (&source == &dest) ? dest.size - 1 : dest.size;
+    if (newIndex < 0 || newIndex > destSize)
+        throw out_of_range("Índice fora dos limites da lista.");
+    source.unlink(*object);
+    dest.linkAt(*object, newIndex);
+}
+
+#endif // INTRUSIVE_DOUBLY_LINKED_LIST_H
@@ -0,0 +1,378 @@
+#ifndef PARALLEL_DOUBLY_LINKED_LIST_H
+#define PARALLEL_DOUBLY_LINKED_LIST_H
+
+#include "ListaGenericaDE.h"
+
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+Descrição:
+Algoritmos paralelos sobre a DoublyLinkedList: for_each, transform,
+reduce, find/count e merge sort.
+A lista é dividida uma única vez em segmentos contíguos por um percurso
+linear (divisão a cada n/k nós) e cada segmento é processado por uma
+thread; a thread que chamou o algoritmo processa o primeiro segmento.
+O sort corta a própria cadeia de nós nos segmentos, ordena cada um em
+paralelo, intercala os segmentos vizinhos em rodadas paralelas e religa
+o resultado: nenhum valor é copiado.
+Regras de uso:
+  - a lista não pode ser alterada por outra thread durante o algoritmo;
+  - as funções recebidas (f, op, pred, comp) são copiadas para cada
+    segmento e rodam concorrentemente: não devem compartilhar estado
+    sem sincronização;
+  - listas pequenas (menos de 2 * ParallelMinSegment elementos) ou
+    threads == 1 usam o caminho sequencial;
+  - se alguma thread lançar exceção, as demais terminam o seu segmento
+    e a exceção do segmento de menor posição é relançada.
+*/
+
+// Tamanho mínimo de um segmento: abaixo disso criar uma thread custa
+// mais do que percorrer os nós.
+const int ParallelMinSegment = 4096;
+
+/*---------------------------------------------------------------
+ * Função parallelSegmentCount()
+ * Descrição: Quantidade de segmentos usada para 'n' elementos.
+ * Parâmetros:
+ *    - n: quantidade de elementos.
+ *    - threads: máximo de threads (0 para hardware_concurrency()).
+ *---------------------------------------------------------------*/
+inline int parallelSegmentCount(int n, unsigned threads) {
+    if (threads == 0)
+        threads = thread::hardware_concurrency();
+    int bySize = n / ParallelMinSegment;
+    int k = (threads < static_cast<unsigned>(bySize)) ? static_cast<int>(threads) : bySize;
+    return (k < 1) ? 1 : k;
+}
+
+// Primeira posição do segmento i entre k segmentos de n elementos.
+inline int parallelSegmentBegin(int n, int k, int i) {
+    return static_cast<int>(static_cast<long long>(n) * i / k);
+}
+
+// Executa task(i), guardando a exceção lançada (se houver) em 'error'.
+template <typename Task>
+void runParallelTask(const Task& task, int i, exception_ptr& error) {
+    try {
+        task(i);
+    } catch (...) {
+        error = current_exception();
+    }
+}
+
+/*---------------------------------------------------------------
+ * Função runParallelTasks()
+ * Descrição: Executa task(0) a task(count - 1) em paralelo: task(0) na
+ *            thread atual e as demais em novas threads. Se não for
+ *            possível criar uma thread, as tarefas restantes rodam na
+ *            thread atual. Espera todas terminarem.
+ * Retorno:
+ *    - exceção da tarefa de menor índice que falhou (ou nula).
+ *---------------------------------------------------------------*/
+template <typename Task>
+exception_ptr runParallelTasks(int count, const Task& task) {
+    vector<exception_ptr> errors(count);
+    vector<thread> workers;
+    workers.reserve(count);
+    int inlineFrom = count;
+    for (int i = 1; i < count; i++) {
+        try {
+            workers.push_back(thread(runParallelTask<Task>, cref(task), i, ref(errors[i])));
+        } catch (const system_error&) {
+            inlineFrom = i;
+            break;
+        }
+    }
+    runParallelTask(task, 0, errors[0]);
+    for (int i = inlineFrom; i < count; i++)
+        runParallelTask(task, i, errors[i]);
+    for (size_t t = 0; t < workers.size(); t++)
+        workers[t].join();
+    for (int i = 0; i < count; i++) {
+        if (errors[i])
+            return errors[i];
+    }
+    return exception_ptr();
+}
+
+/*---------------------------------------------------------------
+ * Função splitSegments()
+ * Descrição: Divisão linear da lista: percorre os nós uma única vez e
+ *            guarda em bounds os k + 1 iteradores que delimitam os
+ *            segmentos (bounds[k] é end()).
+ *---------------------------------------------------------------*/
+template <typename List, typename Iterator>
+void splitSegments(List& list, int k, vector<Iterator>& bounds) {
+    int n = list.length();
+    bounds.clear();
+    bounds.reserve(k + 1);
+    Iterator current = list.begin();
+    int position = 0;
+    for (int i = 0; i < k; i++) {
+        int target = parallelSegmentBegin(n, k, i);
+        for (; position < target; position++)
+            ++current;
+        bounds.push_back(current);
+    }
+    bounds.push_back(list.end());
+}
+
+/*---------------------------------------------------------------
+ * Função parallelForEach()
+ * Descrição: Aplica f a cada elemento da lista, em paralelo.
+ * Parâmetros:
+ *    - list: lista percorrida.
+ *    - f: função aplicada a cada elemento (recebe uma referência).
+ *    - threads: máximo de threads (0 para hardware_concurrency()).
+ *---------------------------------------------------------------*/
+template <typename List, typename Function>
+void parallelForEach(List& list, Function f, unsigned threads = 0) {
+    typedef decltype(list.begin()) Iterator;
+    int k = parallelSegmentCount(list.length(), threads);
+    vector<Iterator> bounds;
+    splitSegments(list, k, bounds);
+    exception_ptr error = runParallelTasks(k, [&](int i) {
+        Function segmentF(f);
+        for (Iterator it = bounds[i]; it != bounds[i + 1]; ++it)
+            segmentF(*it);
+    });
+    if (error)
+        rethrow_exception(error);
+}
+
+/*---------------------------------------------------------------
+ * Função parallelTransform()
+ * Descrição: Substitui, em paralelo, cada elemento x por op(x).
+ *            Assim como as alterações por operator[], não atualiza um
+ *            HashValueIndex.
+ * Parâmetros:
+ *    - list: lista alterada.
+ *    - op: função que recebe o valor atual e retorna o novo.
+ *    - threads: máximo de threads (0 para hardware_concurrency()).
+ *---------------------------------------------------------------*/
+template <typename List, typename UnaryOp>
+void parallelTransform(List& list, UnaryOp op, unsigned threads = 0) {
+    typedef typename List::iterator Iterator;
+    int k = parallelSegmentCount(list.length(), threads);
+    vector<Iterator> bounds;
+    splitSegments(list, k, bounds);
+    exception_ptr error = runParallelTasks(k, [&](int i) {
+        UnaryOp segmentOp(op);
+        for (Iterator it = bounds[i]; it != bounds[i + 1]; ++it)
+            *it = segmentOp(*it);
+    });
+    if (error)
+        rethrow_exception(error);
+}
+
+/*---------------------------------------------------------------
+ * Função parallelReduce()
+ * Descrição: Combina init e todos os elementos com op, em paralelo.
+ *            Cada segmento é reduzido a partir do seu primeiro
+ *            elemento e os resultados parciais são combinados na ordem
+ *            da lista: op deve ser associativa (não precisa ser
+ *            comutativa).
+ * Parâmetros:
+ *    - list: lista percorrida.
+ *    - init: valor inicial.
+ *    - op: operação binária associativa.
+ *    - threads: máximo de threads (0 para hardware_concurrency()).
+ * Retorno:
+ *    - init op x0 op x1 op ... op xn-1.
+ *---------------------------------------------------------------*/
+template <typename List, typename Value, typename BinaryOp>
+Value parallelReduce(const List& list, Value init, BinaryOp op, unsigned threads = 0) {
+    typedef typename List::const_iterator Iterator;
+    int k = parallelSegmentCount(list.length(), threads);
+    vector<Iterator> bounds;
+    splitSegments(list, k, bounds);
+    vector<Value> partials(k, init);
+    exception_ptr error = runParallelTasks(k, [&](int i) {
+        BinaryOp segmentOp(op);
+        Iterator it = bounds[i];
+        if (it == bounds[i + 1])
+            return;
+        Value partial(*it);
+        for (++it; it != bounds[i + 1]; ++it)
+            partial = segmentOp(partial, *it);
+        partials[i] = std::move(partial);
+    });
+    if (error)
+        rethrow_exception(error);
+    for (int i = 0; i < k; i++) {
+        if (bounds[i] != bounds[i + 1])
+            init = op(init, partials[i]);
+    }
+    return init;
+}
+
+/*---------------------------------------------------------------
+ * Função parallelFindIf()
+ * Descrição: Busca, em paralelo, o primeiro elemento que satisfaz
+ *            pred. Um segmento para assim que algum segmento anterior
+ *            encontra um elemento.
+ * Parâmetros:
+ *    - list: lista percorrida.
+ *    - pred: predicado aplicado aos elementos.
+ *    - threads: máximo de threads (0 para hardware_concurrency()).
+ * Retorno:
+ *    - iterador para o primeiro elemento encontrado (end() se nenhum).
+ *---------------------------------------------------------------*/
+template <typename List, typename Predicate>
+auto parallelFindIf(List& list, Predicate pred, unsigned threads = 0) -> decltype(list.begin()) {
+    typedef decltype(list.begin()) Iterator;
+    int k = parallelSegmentCount(list.length(), threads);
+    vector<Iterator> bounds;
+    splitSegments(list, k, bounds);
+    vector<Iterator> results(bounds);
+    atomic<int> found(k);   // Menor segmento que já encontrou um elemento
+    exception_ptr error = runParallelTasks(k, [&](int i) {
+        Predicate segmentPred(pred);
+        for (Iterator it = bounds[i]; it != bounds[i + 1]; ++it) {
+            if (found.load(memory_order_relaxed) < i)
+                return;
+            if (segmentPred(*it)) {
+                results[i] = it;
+                int best = found.load(memory_order_relaxed);
+                while (i < best && !found.compare_exchange_weak(best, i, memory_order_relaxed)) {}
+                return;
+            }
+        }
+    });
+    if (error)
+        rethrow_exception(error);
+    int best = found.load();
+    return (best < k) ? results[best] : list.end();
+}
+
+/*---------------------------------------------------------------
+ * Função parallelFind()
+ * Descrição: Busca, em paralelo, o primeiro elemento igual a 'value'.
+ * Retorno:
+ *    - iterador para o elemento encontrado (end() se não houver).
+ *---------------------------------------------------------------*/
+template <typename List, typename Value>
+auto parallelFind(List& list, const Value& value, unsigned threads = 0) -> decltype(list.begin()) {
+    return parallelFindIf(list, [&value](const Value& x) { return x == value; }, threads);
+}
+
+/*---------------------------------------------------------------
+ * Função parallelCountIf()
+ * Descrição: Conta, em paralelo, os elementos que satisfazem pred.
+ *---------------------------------------------------------------*/
+template <typename List, typename Predicate>
+int parallelCountIf(const List& list, Predicate pred, unsigned threads = 0) {
+    typedef typename List::const_iterator Iterator;
+    int k = parallelSegmentCount(list.length(), threads);
+    vector<Iterator> bounds;
+    splitSegments(list, k, bounds);
+    vector<int> counts(k, 0);
+    exception_ptr error = runParallelTasks(k, [&](int i) {
+        Predicate segmentPred(pred);
+        int count = 0;
+        for (Iterator it = bounds[i]; it != bounds[i + 1]; ++it) {
+            if (segmentPred(*it))
+                count++;
+        }
+        counts[i] = count;
+    });
+    if (error)
+        rethrow_exception(error);
+    int total = 0;
+    for (int i = 0; i < k; i++)
+        total += counts[i];
+    return total;
+}
+
+/*---------------------------------------------------------------
+ * Função parallelCount()
+ * Descrição: Conta, em paralelo, os elementos iguais a 'value'.
+ *---------------------------------------------------------------*/
+template <typename List, typename Value>
+int parallelCount(const List& list, const Value& value, unsigned threads = 0) {
+    return parallelCountIf(list, [&value](const Value& x) { return x == value; }, threads);
+}
+
+/*---------------------------------------------------------------
+ * Função template parallelSort()
+ * Descrição: Merge sort paralelo e estável que apenas religa os nós.
+ *            A cadeia é cortada em k segmentos por um percurso linear,
+ *            cada segmento é ordenado por uma thread e os segmentos
+ *            vizinhos são intercalados em rodadas paralelas (k/2, k/4,
+ *            ..., 1 intercalações). Por fim os ponteiros prev são
+ *            refeitos em uma passada. Os iteradores continuam válidos.
+ *            Se comp lançar exceção, a lista mantém todos os elementos,
+ *            em ordem parcial.
+ * Parâmetros:
+ *    - list: lista ordenada.
+ *    - comp: comparação "menor que" (padrão: operator<).
+ *    - threads: máximo de threads (0 para hardware_concurrency()).
+ *---------------------------------------------------------------*/
+template <typename T, typename Allocator, typename ValueIndex, typename Instrumentation, typename Compare>
+void parallelSort(DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& list, Compare comp,
+                  unsigned threads) {
+    typedef DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation> List;
+    typename Instrumentation::Scope scope(list.metrics, ListOperation::Sort);
+    int n = list.size;
+    int k = parallelSegmentCount(n, threads);
+    if (k < 2) {
+        list.sort(comp);
+        return;
+    }
+    // Divisão linear: corta a cadeia em k segmentos ligados apenas por next
+    vector<Node<T>*> chains(k);
+    list.metrics.traversed(n);
+    Node<T>* current = list.head;
+    for (int i = 0; i < k; i++) {
+        chains[i] = current;
+        int count = parallelSegmentBegin(n, k, i + 1) - parallelSegmentBegin(n, k, i);
+        for (int j = 1; j < count; j++)
+            current = current->next;
+        Node<T>* next = current->next;
+        current->next = nullptr;
+        current = next;
+    }
+
+    exception_ptr error = runParallelTasks(k, [&](int i) {
+        Compare segmentComp(comp);
+        List::sortChain(chains[i], segmentComp);
+    });
+    // Rodadas de intercalação: chains[i] absorve chains[i + width]
+    for (int width = 1; width < k && !error; width *= 2) {
+        int tasks = (k - width + 2 * width - 1) / (2 * width);
+        error = runParallelTasks(tasks, [&](int t) {
+            int i = 2 * width * t;
+            Node<T>* later = chains[i + width];
+            chains[i + width] = nullptr;
+            Compare segmentComp(comp);
+            List::mergeChains(chains[i], later, segmentComp);
+        });
+    }
+
+    // Após uma falha sobram várias cadeias: são juntadas na ordem
+    Node<T>* chain = nullptr;
+    for (int i = 0; i < k; i++) {
+        if (chains[i] != nullptr)
+            List::appendChain(chain, chains[i]);
+    }
+    list.relinkChain(chain);
+    if (error)
+        rethrow_exception(error);
+}
+
+template <typename T, typename Allocator, typename ValueIndex, typename Instrumentation, typename Compare>
+void parallelSort(DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& list, Compare comp) {
+    parallelSort(list, comp, 0);
+}
+
+template <typename T, typename Allocator, typename ValueIndex, typename Instrumentation>
+void parallelSort(DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& list) {
+    parallelSort(list, less<T>(), 0);
+}
+
+#endif // PARALLEL_DOUBLY_LINKED_LIST_H
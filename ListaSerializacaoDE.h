@@ -0,0 +1,373 @@
+#ifndef SERIALIZED_DOUBLY_LINKED_LIST_H
+#define SERIALIZED_DOUBLY_LINKED_LIST_H
+
+#include "ListaGenericaDE.h"
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LISTA_SERIALIZACAO_MMAP 1
+#endif
+
+/*
+Descrição:
+Serialização binária da DoublyLinkedList: save() percorre a lista uma
+única vez gravando em blocos, e load() monta toda a cadeia de nós em uma
+passada (pushRange) a partir do arquivo mapeado em memória (mmap), sem
+N chamadas de push nem análise de texto.
+Formato (ordem de bytes da máquina que gravou):
+  - cabeçalho de 16 bytes: "LDEB", versão (1 byte), tipo de codificação
+    (1 byte), tamanho do elemento (2 bytes, 0 para tamanho variável) e
+    quantidade de elementos (8 bytes);
+  - elementos: para T trivialmente copiável, os sizeof(T) bytes de cada
+    valor; para string, o tamanho (4 bytes) seguido dos caracteres.
+Outros tipos podem ser gravados especializando BinaryCodec<T>.
+*/
+
+/*---------------------------------------------------------------
+ * Template da estrutura BinaryCodec
+ * Descrição: Codificação de um valor no formato binário. A versão
+ *            padrão copia os bytes de tipos trivialmente copiáveis.
+ * Interface esperada de toda codificação:
+ *    - kind: identificador gravado no cabeçalho.
+ *    - elementSize: bytes por elemento (0 para tamanho variável).
+ *    - encode(value, buffer): acrescenta os bytes de value ao buffer.
+ *    - decode(cursor, end): lê um valor da memória e avança cursor.
+ *    - read(in): lê um valor do stream.
+ *---------------------------------------------------------------*/
+template <typename T>
+struct BinaryCodec {
+    static_assert(is_trivially_copyable<T>::value,
+                  "BinaryCodec: especialize para tipos que não são trivialmente copiáveis.");
+
+    static const unsigned char kind = 0;
+    static const unsigned short elementSize = sizeof(T);
+
+    static void encode(const T& value, vector<char>& buffer) {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    static T decode(const char*& cursor, const char* end) {
+        if (static_cast<size_t>(end - cursor) < sizeof(T))
+            throw runtime_error("Arquivo binário truncado.");
+        T value;
+        memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return value;
+    }
+
+    static T read(istream& in) {
+        T value;
+        if (!in.read(reinterpret_cast<char*>(&value), sizeof(T)))
+            throw runtime_error("Arquivo binário truncado.");
+        return value;
+    }
+};
+
+template <>
+struct BinaryCodec<string> {
+    static const unsigned char kind = 1;
+    static const unsigned short elementSize = 0;
+
+    static void encode(const string& value, vector<char>& buffer) {
+        if (value.size() > UINT32_MAX)
+            throw length_error("String grande demais para o formato binário.");
+        uint32_t length = static_cast<uint32_t>(value.size());
+        const char* bytes = reinterpret_cast<const char*>(&length);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(length));
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    static string decode(const char*& cursor, const char* end) {
+        uint32_t length = BinaryCodec<uint32_t>::decode(cursor, end);
+        if (static_cast<size_t>(end - cursor) < length)
+            throw runtime_error("Arquivo binário truncado.");
+        string value(cursor, length);
+        cursor += length;
+        return value;
+    }
+
+    // O tamanho vem do arquivo e não é confiável: os caracteres são lidos
+    // em blocos que no máximo dobram o que já foi lido, de modo que um
+    // tamanho corrompido não aloca muito além do que o stream contém
+    // (o stream pode não permitir consultar o tamanho restante).
+    static string read(istream& in) {
+        const size_t Chunk = 64 * 1024;
+        uint32_t length = BinaryCodec<uint32_t>::read(in);
+        string value;
+        while (value.size() < length) {
+            size_t done = value.size();
+            size_t step = length - done;
+            size_t limit = done > Chunk ? done : Chunk;
+            if (step > limit)
+                step = limit;
+            value.resize(done + step);
+            if (!in.read(&value[done], static_cast<streamsize>(step)))
+                throw runtime_error("Arquivo binário truncado.");
+        }
+        return value;
+    }
+};
+
+/*---------------------------------------------------------------
+ * Estrutura BinaryHeader
+ * Descrição: Cabeçalho de 16 bytes do formato binário.
+ *---------------------------------------------------------------*/
+struct BinaryHeader {
+    static const int Size = 16;
+    static const unsigned char Version = 1;
+
+    unsigned char kind;
+    unsigned short elementSize;
+    uint64_t count;
+
+    void encode(char* out) const {
+        memcpy(out, "LDEB", 4);
+        out[4] = static_cast<char>(Version);
+        out[5] = static_cast<char>(kind);
+        memcpy(out + 6, &elementSize, 2);
+        memcpy(out + 8, &count, 8);
+    }
+
+    // Lê e valida o cabeçalho para o tipo T. Lança exceção se o arquivo
+    // não estiver no formato ou tiver sido gravado para outro tipo.
+    template <typename T>
+    static BinaryHeader decode(const char* in) {
+        if (memcmp(in, "LDEB", 4) != 0)
+            throw runtime_error("Arquivo não está no formato binário da lista.");
+        if (static_cast<unsigned char>(in[4]) != Version)
+            throw runtime_error("Versão do formato binário não suportada.");
+        BinaryHeader header;
+        header.kind = static_cast<unsigned char>(in[5]);
+        memcpy(&header.elementSize, in + 6, 2);
+        memcpy(&header.count, in + 8, 8);
+        if (header.kind != BinaryCodec<T>::kind || header.elementSize != BinaryCodec<T>::elementSize)
+            throw runtime_error("Arquivo binário gravado para outro tipo de elemento.");
+        if (header.count > static_cast<uint64_t>(INT_MAX))
+            throw runtime_error("Arquivo binário com elementos demais para a lista.");
+        return header;
+    }
+};
+
+/*---------------------------------------------------------------
+ * Template da classe BinaryDecodeIterator
+ * Descrição: Iterador de entrada que decodifica 'count' valores de um
+ *            bloco de memória, usado para montar a lista com pushRange.
+ *            operator* devolve o valor decodificado por referência, para
+ *            que possa ser movido para o nó (make_move_iterator).
+ *---------------------------------------------------------------*/
+template <typename T>
+class BinaryDecodeIterator {
+public:
+    typedef input_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef ptrdiff_t difference_type;
+    typedef T* pointer;
+    typedef T& reference;
+
+    // Iterador final (nenhum valor restante)
+    BinaryDecodeIterator() : cursor(nullptr), end(nullptr), remaining(0), value() {}
+
+    BinaryDecodeIterator(const char* data, const char* dataEnd, uint64_t count)
+        : cursor(data), end(dataEnd), remaining(count), value() {
+        if (remaining > 0)
+            value = BinaryCodec<T>::decode(cursor, end);
+    }
+
+    T& operator*() const { return value; }
+    T* operator->() const { return &value; }
+
+    BinaryDecodeIterator& operator++() {
+        if (--remaining > 0)
+            value = BinaryCodec<T>::decode(cursor, end);
+        return *this;
+    }
+
+    friend bool operator==(const BinaryDecodeIterator& a, const BinaryDecodeIterator& b) {
+        return a.remaining == b.remaining;
+    }
+    friend bool operator!=(const BinaryDecodeIterator& a, const BinaryDecodeIterator& b) {
+        return a.remaining != b.remaining;
+    }
+
+private:
+    const char* cursor;
+    const char* end;
+    uint64_t remaining;
+    mutable T value;   // Valor atual (pode ser movido por operator* const)
+};
+
+/*---------------------------------------------------------------
+ * Classe MappedFile
+ * Descrição: Arquivo inteiro somente leitura na memória: mapeado com
+ *            mmap em sistemas POSIX ou, nos demais, lido para um buffer.
+ *            Lança exceção se o arquivo não puder ser aberto.
+ *---------------------------------------------------------------*/
+class MappedFile {
+private:
+    const char* bytes;
+    size_t length;
+#ifdef LISTA_SERIALIZACAO_MMAP
+    void* mapping;
+#endif
+    vector<char> buffer;
+
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+public:
+    explicit MappedFile(const string& path) : bytes(nullptr), length(0) {
+#ifdef LISTA_SERIALIZACAO_MMAP
+        mapping = nullptr;
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw runtime_error("Não foi possível abrir o arquivo: " + path);
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            throw runtime_error("Não foi possível ler o tamanho do arquivo: " + path);
+        }
+        length = static_cast<size_t>(info.st_size);
+        if (length > 0) {
+            void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                close(fd);
+                throw runtime_error("Não foi possível mapear o arquivo: " + path);
+            }
+            // Leitura sequencial: o kernel antecipa as próximas páginas
+            madvise(p, length, MADV_SEQUENTIAL);
+            mapping = p;
+            bytes = static_cast<const char*>(p);
+        }
+        close(fd);
+#else
+        ifstream in(path.c_str(), ios::binary);
+        if (!in)
+            throw runtime_error("Não foi possível abrir o arquivo: " + path);
+        buffer.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+        length = buffer.size();
+        bytes = buffer.empty() ? nullptr : &buffer[0];
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef LISTA_SERIALIZACAO_MMAP
+        if (mapping != nullptr)
+            munmap(mapping, length);
+#endif
+    }
+
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+/*---------------------------------------------------------------
+ * Função template save(list, out)
+ * Descrição: Grava a lista no stream, no formato binário, percorrendo
+ *            os nós uma única vez e escrevendo em blocos de 64 KiB.
+ *            Lança exceção se a escrita falhar.
+ *---------------------------------------------------------------*/
+template <typename T, typename Allocator, typename ValueIndex, typename Instrumentation>
+void save(const DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& list, ostream& out) {
+    typedef DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation> List;
+    const size_t BlockSize = 64 * 1024;
+    BinaryHeader header;
+    header.kind = BinaryCodec<T>::kind;
+    header.elementSize = BinaryCodec<T>::elementSize;
+    header.count = static_cast<uint64_t>(list.length());
+    vector<char> buffer(BinaryHeader::Size);
+    buffer.reserve(BlockSize + BinaryHeader::Size);
+    header.encode(&buffer[0]);
+    for (typename List::const_iterator it = list.begin(); it != list.end(); ++it) {
+        BinaryCodec<T>::encode(*it, buffer);
+        if (buffer.size() >= BlockSize) {
+            out.write(&buffer[0], static_cast<streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    if (!buffer.empty())
+        out.write(&buffer[0], static_cast<streamsize>(buffer.size()));
+    if (!out)
+        throw runtime_error("Falha ao gravar a lista.");
+}
+
+/*---------------------------------------------------------------
+ * Função template save(list, path)
+ * Descrição: Grava a lista no arquivo 'path' (substituindo-o), no
+ *            formato binário.
+ *---------------------------------------------------------------*/
+template <typename T, typename Allocator, typename ValueIndex, typename Instrumentation>
+void save(const DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& list, const string& path) {
+    ofstream out(path.c_str(), ios::binary | ios::trunc);
+    if (!out)
+        throw runtime_error("Não foi possível criar o arquivo: " + path);
+    save(list, static_cast<ostream&>(out));
+    out.close();
+    if (!out)
+        throw runtime_error("Falha ao gravar a lista.");
+}
+
+/*---------------------------------------------------------------
+ * Função template load(list, path)
+ * Descrição: Substitui o conteúdo da lista pelo do arquivo 'path'.
+ *            O arquivo é mapeado em memória e a cadeia de nós inteira é
+ *            montada em uma passada e religada de uma só vez. Se o
+ *            arquivo for inválido a lista não é alterada.
+ *---------------------------------------------------------------*/
+template <typename T, typename Allocator, typename ValueIndex, typename Instrumentation>
+void load(DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& list, const string& path) {
+    MappedFile file(path);
+    if (file.size() < static_cast<size_t>(BinaryHeader::Size))
+        throw runtime_error("Arquivo não está no formato binário da lista.");
+    BinaryHeader header = BinaryHeader::decode<T>(file.data());
+    const char* first = file.data() + BinaryHeader::Size;
+    const char* last = file.data() + file.size();
+    if (BinaryCodec<T>::elementSize != 0 &&
+        static_cast<uint64_t>(last - first) != header.count * BinaryCodec<T>::elementSize)
+        throw runtime_error("Arquivo binário truncado.");
+    DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation> loaded;
+    loaded.pushRange(make_move_iterator(BinaryDecodeIterator<T>(first, last, header.count)),
+                     make_move_iterator(BinaryDecodeIterator<T>()));
+    list.swap(loaded);
+}
+
+/*---------------------------------------------------------------
+ * Função template load(list, in)
+ * Descrição: Substitui o conteúdo da lista pelo lido do stream. Os
+ *            valores são lidos em blocos e cada bloco é anexado com
+ *            pushRange. Se os dados forem inválidos a lista não é
+ *            alterada.
+ *---------------------------------------------------------------*/
+template <typename T, typename Allocator, typename ValueIndex, typename Instrumentation>
+void load(DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation>& list, istream& in) {
+    const uint64_t BlockElements = 4096;
+    char raw[BinaryHeader::Size];
+    if (!in.read(raw, BinaryHeader::Size))
+        throw runtime_error("Arquivo não está no formato binário da lista.");
+    BinaryHeader header = BinaryHeader::decode<T>(raw);
+    DoublyLinkedList<T, Allocator, ValueIndex, Instrumentation> loaded;
+    vector<T> block;
+    block.reserve(static_cast<size_t>(header.count < BlockElements ? header.count : BlockElements));
+    for (uint64_t done = 0; done < header.count;) {
+        block.clear();
+        for (; done < header.count && block.size() < BlockElements; done++)
+            block.push_back(BinaryCodec<T>::read(in));
+        loaded.pushRange(make_move_iterator(block.begin()), make_move_iterator(block.end()));
+    }
+    list.swap(loaded);
+}
+
+#endif // SERIALIZED_DOUBLY_LINKED_LIST_H
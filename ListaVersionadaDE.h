@@ -0,0 +1,563 @@
+#ifndef VERSIONED_DOUBLY_LINKED_LIST_H
+#define VERSIONED_DOUBLY_LINKED_LIST_H
+
+#include "ListaGenericaDE.h"
+#include "FilaLockFreeDE.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/*
+Descrição:
+Lista versionada para um escritor e muitos leitores. Os elementos ficam
+em uma árvore persistente (treap implícita: a posição de cada nó é dada
+pelo tamanho das subárvores) cujos nós nunca são alterados depois de
+publicados. Cada alteração (insertAt, popAt, move, set, ...) copia
+apenas os O(log n) nós do caminho até a posição e publica a nova raiz;
+as versões anteriores continuam intactas.
+Um leitor chama snapshot() e recebe, em O(1) e sem travas, uma visão
+imutável da versão publicada: get, operator[], printAll e iteradores
+sobre ela nunca observam as alterações seguintes do escritor.
+Os nós são compartilhados entre versões por contagem de referências
+(shared_ptr): a memória de uma versão antiga é liberada quando o último
+Snapshot que a usa é destruído. A raiz publicada é trocada com o
+EpochReclaimer da fila lock-free, que só libera a raiz anterior quando
+nenhum leitor pode estar copiando-a.
+*/
+
+/*---------------------------------------------------------------
+ * Template da estrutura VersionNode
+ * Descrição: Nó imutável da árvore persistente.
+ * Glossário:
+ *    - data: valor do elemento.
+ *    - left/right: subárvores com os elementos antes / depois deste.
+ *    - size: número de elementos da subárvore (inclui este nó).
+ *    - priority: prioridade aleatória do treap (maior fica acima).
+ *---------------------------------------------------------------*/
+template <typename T>
+struct VersionNode {
+    typedef shared_ptr<const VersionNode> Link;
+
+    T data;
+    Link left;
+    Link right;
+    int size;
+    uint32_t priority;
+
+    template <typename V>
+    VersionNode(V&& value, Link l, Link r, uint32_t p)
+        : data(std::forward<V>(value)), left(std::move(l)), right(std::move(r)),
+          size(1 + (left ? left->size : 0) + (right ? right->size : 0)), priority(p) {}
+};
+
+/*---------------------------------------------------------------
+ * Classe ListSnapshot
+ * Descrição: Visão imutável de uma versão da lista. Copiar um
+ *            snapshot é O(1) e ele pode ser usado (e copiado) por
+ *            qualquer thread sem sincronização.
+ *---------------------------------------------------------------*/
+template <typename T>
+class ListSnapshot {
+private:
+    typedef VersionNode<T> Node;
+    typedef typename Node::Link Link;
+
+    template <typename U>
+    friend class VersionedDoublyLinkedList;
+
+    Link root;                       // Raiz da versão
+    unsigned long long number;       // Número da versão
+
+    ListSnapshot(const Link& r, unsigned long long n) : root(r), number(n) {}
+
+public:
+    /*---------------------------------------------------------------
+     * Classe const_iterator
+     * Descrição: Iterador de avanço em ordem (da posição 0 ao final).
+     *            Guarda o caminho desde a raiz até o nó atual.
+     *---------------------------------------------------------------*/
+    class const_iterator {
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        const_iterator() {}
+
+        reference operator*() const { return path.back()->data; }
+        pointer operator->() const { return &path.back()->data; }
+
+        const_iterator& operator++() {
+            const Node* node = path.back();
+            path.pop_back();
+            descendLeft(node->right.get());
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator copy(*this);
+            ++(*this);
+            return copy;
+        }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b) {
+            return a.current() == b.current();
+        }
+
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) {
+            return a.current() != b.current();
+        }
+
+    private:
+        friend class ListSnapshot;
+
+        vector<const Node*> path;    // Ancestrais ainda não visitados; o último é o atual
+
+        explicit const_iterator(const Node* root) { descendLeft(root); }
+
+        void descendLeft(const Node* node) {
+            for (; node != nullptr; node = node->left.get())
+                path.push_back(node);
+        }
+
+        const Node* current() const { return path.empty() ? nullptr : path.back(); }
+    };
+
+    // Snapshot vazio (versão 0).
+    ListSnapshot() : number(0) {}
+
+    int length() const {
+        return root ? root->size : 0;
+    }
+
+    /*---------------------------------------------------------------
+     * Função version()
+     * Descrição: Número da versão: cresce a cada alteração publicada
+     *            pelo escritor.
+     *---------------------------------------------------------------*/
+    unsigned long long version() const {
+        return number;
+    }
+
+    // Elemento na posição index, em O(log n) esperado.
+    const T& get(int index) const {
+        if (index < 0 || index >= length())
+            throw out_of_range("Índice fora dos limites da lista.");
+        const Node* node = root.get();
+        for (;;) {
+            int leftSize = node->left ? node->left->size : 0;
+            if (index < leftSize) {
+                node = node->left.get();
+            } else if (index == leftSize) {
+                return node->data;
+            } else {
+                index -= leftSize + 1;
+                node = node->right.get();
+            }
+        }
+    }
+
+    const T& operator[](int index) const {
+        return get(index);
+    }
+
+    void print(int index) const {
+        try {
+            cout << "Elemento no índice " << index << ": " << get(index) << endl;
+        } catch (const exception& e) {
+            cout << "Erro ao imprimir: " << e.what() << endl;
+        }
+    }
+
+    void printAll() const {
+        if (!root) {
+            cout << "Lista vazia." << endl;
+            return;
+        }
+        cout << "Elementos da lista: ";
+        for (const_iterator it = begin(); it != end();) {
+            cout << *it;
+            if (++it != end())
+                cout << " -> ";
+        }
+        cout << endl;
+    }
+
+    const_iterator begin() const { return const_iterator(root.get()); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+};
+
+/*---------------------------------------------------------------
+ * Classe VersionedDoublyLinkedList
+ * Descrição: Lista com snapshots para leitores concorrentes.
+ *            Os métodos de alteração e os de leitura do próprio
+ *            escritor (get, operator[], printAll, ...) devem ser
+ *            chamados por uma única thread por vez (o escritor);
+ *            snapshot() pode ser chamado por qualquer thread, ao mesmo
+ *            tempo que o escritor altera a lista.
+ *            Os valores são compartilhados entre versões e, portanto,
+ *            imutáveis: não há operator[] por referência não-const
+ *            (use set) e popAt retorna uma cópia.
+ *---------------------------------------------------------------*/
+template <typename T>
+class VersionedDoublyLinkedList {
+private:
+    typedef VersionNode<T> Node;
+    typedef typename Node::Link Link;
+
+    // Versão publicada para os leitores.
+    struct Version {
+        Link root;
+        unsigned long long number;
+    };
+
+    Link root;                       // Versão atual do escritor
+    unsigned long long number;       // Número da versão atual
+    uint32_t seed;                   // Estado do gerador de prioridades
+    atomic<Version*> published;      // Última versão publicada
+
+    template <typename U>
+    friend void deslocate(VersionedDoublyLinkedList<U>& source, VersionedDoublyLinkedList<U>& dest, int index, int newIndex);
+
+    VersionedDoublyLinkedList(const VersionedDoublyLinkedList&);
+    VersionedDoublyLinkedList& operator=(const VersionedDoublyLinkedList&);
+
+    static void deleteVersion(void* version) {
+        delete static_cast<Version*>(version);
+    }
+
+    static int sizeOf(const Link& node) {
+        return node ? node->size : 0;
+    }
+
+    // Prioridade do próximo nó (xorshift32).
+    uint32_t nextPriority() {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    }
+
+    template <typename V>
+    Link makeLeaf(V&& value) {
+        return make_shared<Node>(std::forward<V>(value), Link(), Link(), nextPriority());
+    }
+
+    // Cópia do nó com novas subárvores (o nó original não é alterado).
+    static Link withChildren(const Link& node, Link left, Link right) {
+        return make_shared<Node>(node->data, std::move(left), std::move(right), node->priority);
+    }
+
+    // Divide t em a (as primeiras 'count' posições) e b (o restante),
+    // copiando apenas o caminho percorrido.
+    static void split(const Link& t, int count, Link& a, Link& b) {
+        if (!t) {
+            a.reset();
+            b.reset();
+        } else if (sizeOf(t->left) >= count) {
+            Link rest;
+            split(t->left, count, a, rest);
+            b = withChildren(t, std::move(rest), t->right);
+        } else {
+            Link rest;
+            split(t->right, count - sizeOf(t->left) - 1, rest, b);
+            a = withChildren(t, t->left, std::move(rest));
+        }
+    }
+
+    // Concatena a e b (todas as posições de a antes das de b).
+    static Link merge(const Link& a, const Link& b) {
+        if (!a)
+            return b;
+        if (!b)
+            return a;
+        if (a->priority > b->priority)
+            return withChildren(a, a->left, merge(a->right, b));
+        return withChildren(b, merge(a, b->left), b->right);
+    }
+
+    // Cópia do caminho até a posição index, com o novo valor nela.
+    template <typename V>
+    static Link assign(const Link& t, int index, V&& value) {
+        int leftSize = sizeOf(t->left);
+        if (index < leftSize)
+            return withChildren(t, assign(t->left, index, std::forward<V>(value)), t->right);
+        if (index > leftSize)
+            return withChildren(t, t->left, assign(t->right, index - leftSize - 1, std::forward<V>(value)));
+        return make_shared<Node>(std::forward<V>(value), t->left, t->right, t->priority);
+    }
+
+    // Método auxiliar para retirar o nó da posição index de 'tree'. O nó
+    // retirado volta sem subárvores em 'node'.
+    static Link extract(const Link& tree, int index, Link& node) {
+        Link before, rest, after;
+        split(tree, index, before, rest);
+        split(rest, 1, node, after);
+        return merge(before, after);
+    }
+
+    // Método auxiliar para inserir o nó isolado 'node' na posição index.
+    static Link insertNode(const Link& tree, int index, const Link& node) {
+        Link before, after;
+        split(tree, index, before, after);
+        return merge(merge(before, node), after);
+    }
+
+    // Torna 'tree' a versão atual e a publica para os leitores. Se a
+    // publicação falhar (sem memória), a lista não é alterada.
+    void commit(Link tree) {
+        Version* fresh = new Version{tree, number + 1};
+        root = std::move(tree);
+        number++;
+        Version* old = published.exchange(fresh, memory_order_acq_rel);
+        EpochReclaimer::instance().retire(old, &deleteVersion);
+    }
+
+    template <typename V>
+    void insertValue(int index, V&& value) {
+        if (index < 0 || index > length())
+            throw out_of_range("Índice fora dos limites da lista.");
+        commit(insertNode(root, index, makeLeaf(std::forward<V>(value))));
+    }
+
+    template <typename V>
+    void setValue(int index, V&& value) {
+        if (index < 0 || index >= length())
+            throw out_of_range("Índice fora dos limites da lista.");
+        commit(assign(root, index, std::forward<V>(value)));
+    }
+
+    // Método auxiliar para obter a posição do primeiro elemento igual a
+    // value (ou -1).
+    int indexOf(const T& value) const {
+        int index = 0;
+        for (const_iterator it = begin(); it != end(); ++it, ++index) {
+            if (*it == value)
+                return index;
+        }
+        return -1;
+    }
+
+    // Visão da versão atual do escritor (sem passar pela publicação).
+    ListSnapshot<T> view() const {
+        return ListSnapshot<T>(root, number);
+    }
+
+public:
+    typedef typename ListSnapshot<T>::const_iterator const_iterator;
+
+    // Construtor da lista: inicializa uma lista vazia (versão 0).
+    VersionedDoublyLinkedList() : number(0), seed(0x9E3779B9u), published(new Version{Link(), 0}) {}
+
+    // Construtor a partir de uma lista de inicialização: {1, 2, 3}.
+    VersionedDoublyLinkedList(initializer_list<T> values) : VersionedDoublyLinkedList() {
+        pushRange(values.begin(), values.end());
+    }
+
+    // Destrutor: os snapshots já obtidos continuam válidos.
+    ~VersionedDoublyLinkedList() {
+        EpochReclaimer::instance().retire(published.load(), &deleteVersion);
+    }
+
+    /*---------------------------------------------------------------
+     * Função snapshot()
+     * Descrição: Retorna, em O(1) e sem travas, uma visão imutável da
+     *            última versão publicada. Pode ser chamada por qualquer
+     *            thread enquanto o escritor altera a lista.
+     *---------------------------------------------------------------*/
+    ListSnapshot<T> snapshot() const {
+        EpochReclaimer::Guard guard(EpochReclaimer::instance());
+        const Version* version = published.load(memory_order_acquire);
+        return ListSnapshot<T>(version->root, version->number);
+    }
+
+    /*---------------------------------------------------------------
+     * Funções push(), pushFirst() e insertAt()
+     * Descrição: Inserem um novo elemento no final, no início ou na
+     *            posição especificada, em O(log n) esperado.
+     *---------------------------------------------------------------*/
+    void push(const T& value) {
+        commit(merge(root, makeLeaf(value)));
+    }
+
+    void push(T&& value) {
+        commit(merge(root, makeLeaf(std::move(value))));
+    }
+
+    void pushFirst(const T& value) {
+        commit(merge(makeLeaf(value), root));
+    }
+
+    void pushFirst(T&& value) {
+        commit(merge(makeLeaf(std::move(value)), root));
+    }
+
+    void insertAt(int index, const T& value) {
+        insertValue(index, value);
+    }
+
+    void insertAt(int index, T&& value) {
+        insertValue(index, std::move(value));
+    }
+
+    /*---------------------------------------------------------------
+     * Função pushRange()
+     * Descrição: Insere os valores de [first, last) no final, publicando
+     *            uma única versão. Retorna quantos foram inseridos.
+     *---------------------------------------------------------------*/
+    template <typename InputIt>
+    int pushRange(InputIt first, InputIt last) {
+        Link tree = root;
+        int count = 0;
+        for (; first != last; ++first, ++count)
+            tree = merge(tree, makeLeaf(*first));
+        if (count > 0)
+            commit(std::move(tree));
+        return count;
+    }
+
+    /*---------------------------------------------------------------
+     * Funções pop(), popFirst(), popAt() e popByValue()
+     * Descrição: Removem o último, o primeiro, o da posição especificada
+     *            ou o primeiro elemento igual a value.
+     *---------------------------------------------------------------*/
+    void pop() {
+        if (length() == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        popAt(length() - 1);
+    }
+
+    void popFirst() {
+        if (length() == 0)
+            throw underflow_error("Lista vazia. Não há elementos para remover.");
+        popAt(0);
+    }
+
+    T popAt(int index) {
+        if (index < 0 || index >= length())
+            throw out_of_range("Índice fora dos limites da lista.");
+        Link node;
+        Link tree = extract(root, index, node);
+        T value(node->data);
+        commit(std::move(tree));
+        return value;
+    }
+
+    void popByValue(const T& value) {
+        int index = indexOf(value);
+        if (index < 0)
+            throw runtime_error("Valor não encontrado na lista.");
+        popAt(index);
+    }
+
+    /*---------------------------------------------------------------
+     * Função move()
+     * Descrição: Move o elemento da posição 'index' para 'newIndex'
+     *            (mesma semântica da DoublyLinkedList::move), publicando
+     *            uma única versão: nenhum leitor vê o elemento fora da
+     *            lista.
+     *---------------------------------------------------------------*/
+    void move(int index, int newIndex) {
+        if (index < 0 || index >= length())
+            throw out_of_range("Índice original fora dos limites da lista.");
+        if (newIndex < 0 || newIndex > length() - 1)
+            throw out_of_range("Novo índice fora dos limites da lista.");
+        if (index == newIndex)
+            return; // Sem alteração
+        Link node;
+        Link tree = extract(root, index, node);
+        // Se o nó removido estava antes da nova posição, ajusta newIndex
+        if (index < newIndex)
+            newIndex--;
+        commit(insertNode(tree, newIndex, node));
+    }
+
+    /*---------------------------------------------------------------
+     * Funções get(), operator[] e set()
+     * Descrição: Leem ou substituem o elemento da posição especificada
+     *            na versão atual do escritor, em O(log n) esperado.
+     *            A referência de get permanece válida enquanto a versão
+     *            que a contém existir (por exemplo, até a próxima
+     *            alteração, se nenhum snapshot a guardar).
+     *---------------------------------------------------------------*/
+    const T& get(int index) const {
+        return view().get(index);
+    }
+
+    const T& operator[](int index) const {
+        return view().get(index);
+    }
+
+    void set(int index, const T& value) {
+        setValue(index, value);
+    }
+
+    void set(int index, T&& value) {
+        setValue(index, std::move(value));
+    }
+
+    // Remove todos os elementos (publica uma versão vazia).
+    void clear() {
+        if (root)
+            commit(Link());
+    }
+
+    int length() const {
+        return sizeOf(root);
+    }
+
+    // Número da versão atual (cresce a cada alteração).
+    unsigned long long version() const {
+        return number;
+    }
+
+    void print(int index) const {
+        view().print(index);
+    }
+
+    void printAll() const {
+        view().printAll();
+    }
+
+    // Iteradores sobre a versão atual do escritor (invalidados pela
+    // próxima alteração, se nenhum snapshot guardar a versão).
+    const_iterator begin() const { return view().begin(); }
+    const_iterator end() const { return view().end(); }
+};
+
+/*---------------------------------------------------------------
+ * Função template deslocate() (lista versionada)
+ * Descrição: Desloca o elemento do índice 'index' da lista 'source'
+ *            para a posição 'newIndex' na lista 'dest'. O nó retirado
+ *            é reaproveitado no destino (as versões são imutáveis e
+ *            podem compartilhar nós). Cada lista publica uma versão.
+ *---------------------------------------------------------------*/
+template <typename T>
+void deslocate(VersionedDoublyLinkedList<T>& source, VersionedDoublyLinkedList<T>& dest, int index, int newIndex) {
+    typedef typename VersionedDoublyLinkedList<T>::Link Link;
+    if (index < 0 || index >= source.length())
+        throw out_of_range("Índice fora dos limites da lista.");
+    // newIndex é contado depois da retirada do nó (como na DoublyLinkedList)
+    int destSize = (&source == &dest) ? dest.length() - 1 : dest.length();
+    if (newIndex < 0 || newIndex > destSize)
+        throw out_of_range("Índice fora dos limites da lista.");
+    Link node;
+    Link sourceTree = VersionedDoublyLinkedList<T>::extract(source.root, index, node);
+    if (&source == &dest) {
+        source.commit(VersionedDoublyLinkedList<T>::insertNode(sourceTree, newIndex, node));
+        return;
+    }
+    Link destTree = VersionedDoublyLinkedList<T>::insertNode(dest.root, newIndex, node);
+    source.commit(std::move(sourceTree));
+    dest.commit(std::move(destTree));
+}
+
+#endif // VERSIONED_DOUBLY_LINKED_LIST_H
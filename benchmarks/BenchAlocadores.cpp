@@ -0,0 +1,78 @@
+/*
+Benchmark das políticas de alocação de nós da DoublyLinkedList.
+Compara a alocação individual no heap (HeapNodeAllocator, comportamento
+original) com o pool de slabs (PoolNodeAllocator) e a arena
+(ArenaNodeAllocator) em dois cenários:
+  - construção e destruição: N chamadas a push seguidas da destruição
+    da lista;
+  - rotatividade (churn): fila com K elementos em que cada iteração faz
+    um push e um popFirst.
+Uso: ./bench_alocadores [N]
+*/
+
+#include "../ListaGenericaDE.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Mede o tempo de execução de f em milissegundos.
+template <typename F>
+double medirMs(F f) {
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    f();
+    chrono::steady_clock::time_point fim = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(fim - inicio).count();
+}
+
+// Gera o valor de índice i para o tipo testado.
+template <typename T> T gerarValor(int i);
+template <> int gerarValor<int>(int i) { return i; }
+template <> string gerarValor<string>(int i) { return "item-" + to_string(i); }
+
+template <typename Lista, typename T>
+void construirEDestruir(int n) {
+    Lista lista;
+    for (int i = 0; i < n; i++)
+        lista.push(gerarValor<T>(i));
+}
+
+template <typename Lista, typename T>
+void rotatividade(int n) {
+    Lista lista;
+    const int k = 1024;
+    for (int i = 0; i < k; i++)
+        lista.push(gerarValor<T>(i));
+    for (int i = 0; i < n; i++) {
+        lista.push(gerarValor<T>(i));
+        lista.popFirst();
+    }
+}
+
+template <typename T>
+void executar(const char* nomeTipo, int n) {
+    typedef DoublyLinkedList<T, HeapNodeAllocator<T> > ListaHeap;
+    typedef DoublyLinkedList<T, PoolNodeAllocator<T> > ListaPool;
+    typedef DoublyLinkedList<T, ArenaNodeAllocator<T> > ListaArena;
+
+    cout << "\nTipo: " << nomeTipo << " (N = " << n << ")" << endl;
+    cout << "Cenário                  heap (ms)   pool (ms)   arena (ms)" << endl;
+
+    double h = medirMs([&] { construirEDestruir<ListaHeap, T>(n); });
+    double p = medirMs([&] { construirEDestruir<ListaPool, T>(n); });
+    double a = medirMs([&] { construirEDestruir<ListaArena, T>(n); });
+    printf("construção+destruição  %11.2f %11.2f %12.2f\n", h, p, a);
+
+    // A arena não reaproveita nós removidos, então fica fora da rotatividade
+    h = medirMs([&] { rotatividade<ListaHeap, T>(n); });
+    p = medirMs([&] { rotatividade<ListaPool, T>(n); });
+    printf("rotatividade           %11.2f %11.2f %12s\n", h, p, "-");
+}
+
+int main(int argc, char* argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    executar<int>("int", n);
+    executar<string>("string", n);
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*
+Teste de estresse e benchmark de escalabilidade da lista concorrente.
+Cada thread executa uma mistura aleatória de get, insertAt, popAt, move,
+push/pop nas duas extremidades e deslocate entre duas listas nos dois
+sentidos (o caso que provocaria deadlock sem a ordem fixa de travamento).
+A mesma carga roda sobre uma DoublyLinkedList protegida por um único
+mutex global, para comparação, com 1 até N threads.
+Ao final de cada rodada verifica que nenhum elemento foi perdido ou
+duplicado: a soma e a quantidade de elementos das duas listas devem
+bater com o que as threads inseriram e removeram. Em caso de falha o
+programa termina com código 1.
+Uso: ./bench_concorrencia [threads máx.] [operações por thread]
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../ListaConcorrenteDE.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// DoublyLinkedList protegida por um mutex global (abordagem atual).
+struct ListaComMutexGlobal {
+    DoublyLinkedList<long long> lista;
+    mutex m;
+
+    void push(long long v) { lock_guard<mutex> g(m); lista.push(v); }
+    void pushFirst(long long v) { lock_guard<mutex> g(m); lista.pushFirst(v); }
+    void insertAt(int i, long long v) { lock_guard<mutex> g(m); lista.insertAt(i, v); }
+    long long popAt(int i) { lock_guard<mutex> g(m); return lista.popAt(i); }
+    long long get(int i) { lock_guard<mutex> g(m); return lista.get(i); }
+    void move(int i, int j) { lock_guard<mutex> g(m); lista.move(i, j); }
+    int length() { lock_guard<mutex> g(m); return lista.length(); }
+};
+
+// Com um único mutex global, deslocate trava as duas listas em ordem fixa.
+void deslocate(ListaComMutexGlobal& origem, ListaComMutexGlobal& destino, int index, int newIndex) {
+    ListaComMutexGlobal* a = &origem;
+    ListaComMutexGlobal* b = &destino;
+    if (less<const void*>()(b, a))
+        std::swap(a, b);
+    lock_guard<mutex> ga(a->m);
+    lock_guard<mutex> gb(b->m);
+    deslocate(origem.lista, destino.lista, index, newIndex);
+}
+
+long long somaConcorrente(ConcurrentDoublyLinkedList<long long>& lista) {
+    long long soma = 0;
+    for (int i = 0; i < lista.length(); i++)
+        soma += lista.get(i);
+    return soma;
+}
+
+long long somaConcorrente(ListaComMutexGlobal& lista) {
+    long long soma = 0;
+    for (int i = 0; i < lista.length(); i++)
+        soma += lista.get(i);
+    return soma;
+}
+
+// Uma thread de carga. 'saldo' acumula valores inseridos menos removidos
+// e 'quantidade' a variação do número de elementos.
+template <typename Lista>
+void carga(Lista& a, Lista& b, int ops, unsigned semente, long long& saldo, long long& quantidade) {
+    mt19937 rng(semente);
+    long long proximoValor = static_cast<long long>(semente) * 1000000LL;
+    for (int k = 0; k < ops; k++) {
+        Lista& lista = (rng() & 1) ? a : b;
+        Lista& outra = (&lista == &a) ? b : a;
+        int n = lista.length();
+        try {
+            switch (rng() % 8) {
+            case 0:
+            case 1:
+                if (n > 0)
+                    lista.get(static_cast<int>(rng() % n));
+                break;
+            case 2: {
+                long long v = proximoValor++;
+                lista.insertAt(static_cast<int>(rng() % (n + 1)), v);
+                saldo += v;
+                quantidade++;
+                break;
+            }
+            case 3:
+                if (n > 0) {
+                    saldo -= lista.popAt(static_cast<int>(rng() % n));
+                    quantidade--;
+                }
+                break;
+            case 4:
+                if (n > 1)
+                    lista.move(static_cast<int>(rng() % n), static_cast<int>(rng() % n));
+                break;
+            case 5:
+                if (n > 0)
+                    deslocate(lista, outra, static_cast<int>(rng() % n), static_cast<int>(rng() % (outra.length() + 1)));
+                break;
+            case 6: {
+                long long v = proximoValor++;
+                if (rng() & 1)
+                    lista.push(v);
+                else
+                    lista.pushFirst(v);
+                saldo += v;
+                quantidade++;
+                break;
+            }
+            default:
+                if (n > 0) {
+                    saldo -= lista.popAt((rng() & 1) ? 0 : n - 1);
+                    quantidade--;
+                }
+                break;
+            }
+        } catch (const out_of_range&) {
+            // Outra thread alterou a lista entre length() e a operação
+        }
+    }
+}
+
+// Executa a carga com 'threads' threads e devolve operações por segundo.
+// Retorna -1 se a verificação de consistência falhar.
+template <typename Lista>
+double rodada(int threads, int ops, int inicial) {
+    Lista a, b;
+    long long somaInicial = 0;
+    for (int i = 0; i < inicial; i++) {
+        a.push(i);
+        b.push(inicial + i);
+        somaInicial += i + inicial + i;
+    }
+
+    vector<long long> saldos(threads, 0), quantidades(threads, 0);
+    vector<thread> trabalhadores;
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++)
+        trabalhadores.push_back(thread(carga<Lista>, ref(a), ref(b), ops, static_cast<unsigned>(t + 1),
+                                       ref(saldos[t]), ref(quantidades[t])));
+    for (size_t t = 0; t < trabalhadores.size(); t++)
+        trabalhadores[t].join();
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    long long somaEsperada = somaInicial;
+    long long quantidadeEsperada = 2LL * inicial;
+    for (int t = 0; t < threads; t++) {
+        somaEsperada += saldos[t];
+        quantidadeEsperada += quantidades[t];
+    }
+    if (a.length() + b.length() != quantidadeEsperada || somaConcorrente(a) + somaConcorrente(b) != somaEsperada)
+        return -1;
+    return threads * static_cast<double>(ops) / segundos;
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = (argc > 1) ? atoi(argv[1]) : static_cast<int>(thread::hardware_concurrency());
+    int ops = (argc > 2) ? atoi(argv[2]) : 20000;
+    if (maxThreads < 1)
+        maxThreads = 1;
+    const int inicial = 1000;
+
+    printf("%8s | %18s | %18s\n", "threads", "mutex global op/s", "mão sobre mão op/s");
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        double global = rodada<ListaComMutexGlobal>(t, ops, inicial);
+        double fino = rodada<ConcurrentDoublyLinkedList<long long> >(t, ops, inicial);
+        if (global < 0 || fino < 0) {
+            printf("Falha de consistência com %d threads.\n", t);
+            return 1;
+        }
+        printf("%8d | %18.0f | %18.0f\n", t, global, fino);
+        if (t < maxThreads && t * 2 > maxThreads)
+            t = maxThreads / 2; // Garante uma rodada com maxThreads
+    }
+    printf("Verificação de consistência: ok\n");
+    return 0;
+}
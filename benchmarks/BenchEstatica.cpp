@@ -0,0 +1,110 @@
+/*
+Benchmark de latência da lista estática (ListaEstaticaDE.h) contra a
+DoublyLinkedList com alocação no heap (HeapNodeAllocator) e com o pool
+de slabs (PoolNodeAllocator). Com a lista sempre com K elementos, cada
+iteração faz uma inserção seguida de uma remoção, cronometradas uma a
+uma, em dois cenários:
+  - fila: push seguido de popFirst;
+  - meio: insertAt seguido de popAt em uma posição aleatória.
+A lista estática usa as variantes try_ (sem exceções). Para cada lista
+são informadas a mediana, o percentil 99, o percentil 99,9 e o máximo
+da latência por operação, em ns (incluindo o custo da leitura do
+relógio).
+O uso em tempo de compilação (constexpr) é conferido em
+tests/TesteEstatica.cpp.
+Uso: ./bench_estatica [iterações]
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../ListaEstaticaDE.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+const int K = 64; // Elementos mantidos na lista durante as medições
+
+// Adaptadores: as operações da lista estática usam as variantes try_.
+template <typename Lista>
+struct Operacoes {
+    static void push(Lista& lista, int v) { lista.push(v); }
+    static void popFirst(Lista& lista) { lista.popFirst(); }
+    static void insertAt(Lista& lista, int i, int v) { lista.insertAt(i, v); }
+    static int popAt(Lista& lista, int i) { return lista.popAt(i); }
+};
+
+template <size_t N>
+struct Operacoes<StaticDoublyLinkedList<int, N> > {
+    typedef StaticDoublyLinkedList<int, N> Lista;
+    static void push(Lista& lista, int v) { lista.try_push(v); }
+    static void popFirst(Lista& lista) { lista.try_popFirst(); }
+    static void insertAt(Lista& lista, int i, int v) { lista.try_insertAt(i, v); }
+    static int popAt(Lista& lista, int i) {
+        int v = 0;
+        lista.try_popAt(i, v);
+        return v;
+    }
+};
+
+// Imprime os percentis das latências medidas (ns).
+void imprimir(const char* cenario, const char* lista, vector<double>& ns) {
+    sort(ns.begin(), ns.end());
+    size_t n = ns.size();
+    printf("%-5s | %-14s | %8.0f | %8.0f | %8.0f | %10.0f\n", cenario, lista,
+           ns[n / 2], ns[n * 99 / 100], ns[n * 999 / 1000], ns[n - 1]);
+}
+
+template <typename Lista>
+void medir(const char* nome, int iteracoes) {
+    typedef Operacoes<Lista> Op;
+    typedef chrono::steady_clock Relogio;
+    Lista lista;
+    for (int i = 0; i < K - 1; i++)
+        Op::push(lista, i);
+
+    vector<double> fila;
+    vector<double> meio;
+    fila.reserve(2 * iteracoes);
+    meio.reserve(2 * iteracoes);
+    mt19937 rng(42);
+    long long soma = 0;
+
+    for (int k = 0; k < iteracoes; k++) {
+        Relogio::time_point t0 = Relogio::now();
+        Op::push(lista, k);
+        Relogio::time_point t1 = Relogio::now();
+        Op::popFirst(lista);
+        Relogio::time_point t2 = Relogio::now();
+        fila.push_back(chrono::duration<double, nano>(t1 - t0).count());
+        fila.push_back(chrono::duration<double, nano>(t2 - t1).count());
+    }
+    for (int k = 0; k < iteracoes; k++) {
+        int posicao = static_cast<int>(rng() % K);
+        Relogio::time_point t0 = Relogio::now();
+        Op::insertAt(lista, posicao, k);
+        Relogio::time_point t1 = Relogio::now();
+        soma += Op::popAt(lista, posicao);
+        Relogio::time_point t2 = Relogio::now();
+        meio.push_back(chrono::duration<double, nano>(t1 - t0).count());
+        meio.push_back(chrono::duration<double, nano>(t2 - t1).count());
+    }
+    if (soma < 0)
+        printf("%lld\n", soma);
+    imprimir("fila", nome, fila);
+    imprimir("meio", nome, meio);
+}
+
+int main(int argc, char* argv[]) {
+    int iteracoes = (argc > 1) ? atoi(argv[1]) : 1000000;
+    if (iteracoes <= 0)
+        iteracoes = 1;
+    printf("%d iterações com %d elementos; latência por operação em ns\n", iteracoes, K);
+    printf("%-5s | %-14s | %8s | %8s | %8s | %10s\n", "cen.", "lista", "p50", "p99", "p99,9", "máximo");
+    medir<DoublyLinkedList<int> >("heap", iteracoes);
+    medir<DoublyLinkedList<int, PoolNodeAllocator<int> > >("pool", iteracoes);
+    medir<StaticDoublyLinkedList<int, K> >("estática", iteracoes);
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+Benchmark da fila de trabalho: P produtores chamam push e os
+consumidores retiram os elementos até esvaziar a fila.
+Compara:
+  - DoublyLinkedList protegida por um mutex global (push / popFirst);
+  - LockFreeQueue com tryPopFirst (um elemento por vez);
+  - LockFreeQueue com drain (lotes de até 64 elementos por CAS).
+Para cada P (1 até o máximo informado) são usados 'consumidores'
+consumidores. O programa verifica que todos os elementos produzidos foram
+consumidos exatamente uma vez (pela soma) e termina com código 1 se não.
+Uso: ./bench_fila [produtores máx.] [itens por produtor] [consumidores]
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../FilaLockFreeDE.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fila atual: DoublyLinkedList com um mutex em volta de cada chamada.
+struct FilaComMutex {
+    DoublyLinkedList<long long> lista;
+    mutex m;
+
+    void push(long long v) {
+        lock_guard<mutex> g(m);
+        lista.push(v);
+    }
+
+    bool tryPopFirst(long long& out) {
+        lock_guard<mutex> g(m);
+        if (lista.length() == 0)
+            return false;
+        out = lista.popAt(0);
+        return true;
+    }
+};
+
+enum ModoConsumo { UmPorVez, EmLote };
+
+template <typename Fila>
+int consumir(Fila& fila, vector<long long>& lote, ModoConsumo) {
+    long long v;
+    if (!fila.tryPopFirst(v))
+        return 0;
+    lote.push_back(v);
+    return 1;
+}
+
+int consumir(LockFreeQueue<long long>& fila, vector<long long>& lote, ModoConsumo modo) {
+    if (modo == EmLote)
+        return fila.drain(back_inserter(lote), 64);
+    long long v;
+    if (!fila.tryPopFirst(v))
+        return 0;
+    lote.push_back(v);
+    return 1;
+}
+
+// Devolve milhões de elementos por segundo, ou -1 se a verificação falhar.
+template <typename Fila>
+double rodada(int produtores, int consumidores, int itens, ModoConsumo modo) {
+    Fila fila;
+    long long total = static_cast<long long>(produtores) * itens;
+    atomic<long long> consumidos(0);
+    vector<long long> somas(consumidores, 0);
+    vector<thread> threads;
+
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    for (int p = 0; p < produtores; p++) {
+        threads.push_back(thread([&fila, p, itens] {
+            long long base = static_cast<long long>(p) * itens;
+            for (int i = 0; i < itens; i++)
+                fila.push(base + i);
+        }));
+    }
+    for (int c = 0; c < consumidores; c++) {
+        threads.push_back(thread([&fila, &consumidos, &somas, c, total, modo] {
+            vector<long long> lote;
+            long long soma = 0;
+            while (consumidos.load(memory_order_relaxed) < total) {
+                lote.clear();
+                int n = consumir(fila, lote, modo);
+                if (n == 0) {
+                    this_thread::yield();
+                    continue;
+                }
+                for (size_t i = 0; i < lote.size(); i++)
+                    soma += lote[i];
+                consumidos.fetch_add(n, memory_order_relaxed);
+            }
+            somas[c] = soma;
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++)
+        threads[t].join();
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    long long soma = 0;
+    for (int c = 0; c < consumidores; c++)
+        soma += somas[c];
+    if (consumidos.load() != total || soma != total * (total - 1) / 2)
+        return -1;
+    return total / segundos / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    int maxProdutores = (argc > 1) ? atoi(argv[1]) : 16;
+    int itens = (argc > 2) ? atoi(argv[2]) : 200000;
+    int consumidores = (argc > 3) ? atoi(argv[3]) : 2;
+
+    printf("%10s %12s | %14s %14s %14s\n", "produtores", "consumidores",
+           "mutex (M/s)", "lock-free", "lock-free+drain");
+    for (int p = 1; p <= maxProdutores; p *= 2) {
+        double comMutex = rodada<FilaComMutex>(p, consumidores, itens, UmPorVez);
+        double livre = rodada<LockFreeQueue<long long> >(p, consumidores, itens, UmPorVez);
+        double lote = rodada<LockFreeQueue<long long> >(p, consumidores, itens, EmLote);
+        if (comMutex < 0 || livre < 0 || lote < 0) {
+            printf("Falha de verificação com %d produtores.\n", p);
+            return 1;
+        }
+        printf("%10d %12d | %14.2f %14.2f %14.2f\n", p, consumidores, comMutex, livre, lote);
+    }
+    printf("Verificação: ok\n");
+    return 0;
+}
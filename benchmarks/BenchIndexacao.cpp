@@ -0,0 +1,73 @@
+/*
+Benchmark do acesso posicional: percurso linear da DoublyLinkedList
+(getNodeAt a partir da extremidade mais próxima) contra a skip list
+indexável da IndexedDoublyLinkedList.
+Para cada tamanho N (10^3 até o limite informado) mede o tempo médio de:
+  - leitura em posição aleatória (operator[]);
+  - inserção seguida de remoção em posição aleatória (insertAt + popAt).
+Uso: ./bench_indexacao [N máximo] (padrão 10^7)
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../ListaIndexadaDE.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Mede o tempo de execução de f em milissegundos.
+template <typename F>
+double medirMs(F f) {
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    f();
+    chrono::steady_clock::time_point fim = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(fim - inicio).count();
+}
+
+// Executa 'ops' leituras e 'ops' pares insertAt/popAt em posições
+// aleatórias e devolve o tempo médio por operação em nanossegundos.
+template <typename Lista>
+void medirLista(int n, int ops, double& leituraNs, double& insercaoNs) {
+    Lista lista;
+    for (int i = 0; i < n; i++)
+        lista.push(i);
+
+    mt19937 rng(12345);
+    vector<int> posicoes(ops);
+    for (int i = 0; i < ops; i++)
+        posicoes[i] = static_cast<int>(rng() % n);
+
+    volatile long long soma = 0;
+    double ms = medirMs([&] {
+        for (int i = 0; i < ops; i++)
+            soma += lista[posicoes[i]];
+    });
+    leituraNs = ms * 1e6 / ops;
+
+    ms = medirMs([&] {
+        for (int i = 0; i < ops; i++) {
+            lista.insertAt(posicoes[i], i);
+            lista.popAt(posicoes[i]);
+        }
+    });
+    insercaoNs = ms * 1e6 / ops;
+}
+
+int main(int argc, char* argv[]) {
+    long long limite = (argc > 1) ? atoll(argv[1]) : 10000000LL;
+
+    printf("%10s %8s | %14s %14s | %14s %14s\n", "N", "ops",
+           "linear get", "skip get", "linear ins", "skip ins");
+    for (long long n = 1000; n <= limite; n *= 10) {
+        // Menos operações nos tamanhos grandes: o percurso linear custa O(N)
+        int ops = static_cast<int>(n >= 10000000 ? 50 : n >= 1000000 ? 200 : (n >= 100000 ? 2000 : 20000));
+        double linGet, linIns, skipGet, skipIns;
+        medirLista<DoublyLinkedList<int> >(static_cast<int>(n), ops, linGet, linIns);
+        medirLista<IndexedDoublyLinkedList<int> >(static_cast<int>(n), ops, skipGet, skipIns);
+        printf("%10lld %8d | %11.0f ns %11.0f ns | %11.0f ns %11.0f ns\n",
+               n, ops, linGet, skipGet, linIns, skipIns);
+    }
+    return 0;
+}
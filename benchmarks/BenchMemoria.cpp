@@ -0,0 +1,116 @@
+/*
+Benchmark de memória do layout compacto (ListaCompactaDE.h) contra o
+layout atual da DoublyLinkedList (um Node<T> por alocação, ligado por
+ponteiros), para int, double e string curta (sem alocação própria).
+Para cada lista mede:
+  - bytes por elemento pedidos ao operator new (vivos ao final da
+    construção; no layout compacto incluem a folga do vetor);
+  - bytes por elemento ocupados nos blocos do malloc (estimados pelas
+    regras da glibc em 64 bits: cabeçalho de 8 bytes, alinhamento de 16
+    e bloco mínimo de 32 bytes);
+  - tempo de construção com push e de uma travessia completa.
+Uso: ./bench_memoria [elementos]
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../ListaCompactaDE.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Contadores globais dos bytes vivos pedidos ao operator new e dos bytes
+// que o malloc reserva para eles.
+static size_t bytesPedidos = 0;
+static size_t bytesReservados = 0;
+
+// Bloco do malloc da glibc (64 bits) para um pedido de 'bytes': cabeçalho
+// de 8 bytes, alinhamento de 16 e mínimo de 32 bytes.
+static size_t blocoMalloc(size_t bytes) {
+    size_t bloco = (bytes + sizeof(size_t) + 15) & ~static_cast<size_t>(15);
+    return bloco < 32 ? 32 : bloco;
+}
+
+// Cada alocação guarda o tamanho pedido em um prefixo de 16 bytes, para
+// que operator delete possa descontá-lo.
+const size_t Prefixo = 16;
+
+void* operator new(size_t bytes) {
+    char* p = static_cast<char*>(malloc(bytes + Prefixo));
+    if (!p)
+        throw bad_alloc();
+    *reinterpret_cast<size_t*>(p) = bytes;
+    bytesPedidos += bytes;
+    bytesReservados += blocoMalloc(bytes);
+    return p + Prefixo;
+}
+
+void operator delete(void* p) noexcept {
+    if (!p)
+        return;
+    char* base = static_cast<char*>(p) - Prefixo;
+    size_t bytes = *reinterpret_cast<size_t*>(base);
+    bytesPedidos -= bytes;
+    bytesReservados -= blocoMalloc(bytes);
+    free(base);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    operator delete(p);
+}
+
+template <typename F>
+double medirMs(F f) {
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+}
+
+template <typename T> T gerarValor(int i);
+template <> int gerarValor<int>(int i) { return i; }
+template <> double gerarValor<double>(int i) { return i * 0.5; }
+template <> string gerarValor<string>(int i) { return to_string(i % 1000); }
+
+// Valor acumulado pela travessia, para que ela não seja eliminada.
+template <typename T> double acumular(const T& value) { return static_cast<double>(value); }
+template <> double acumular<string>(const string& value) { return static_cast<double>(value.size()); }
+
+template <typename Lista, typename T>
+void medir(const char* tipo, const char* layout, size_t tamanhoNo, int n) {
+    size_t pedidosAntes = bytesPedidos;
+    size_t reservadosAntes = bytesReservados;
+    Lista lista;
+    double pushMs = medirMs([&] {
+        for (int i = 0; i < n; i++)
+            lista.push(gerarValor<T>(i));
+    });
+    double pedidos = static_cast<double>(bytesPedidos - pedidosAntes) / n;
+    double reservados = static_cast<double>(bytesReservados - reservadosAntes) / n;
+    double soma = 0;
+    double travessiaMs = medirMs([&] {
+        for (typename Lista::const_iterator it = lista.begin(); it != lista.end(); ++it)
+            soma += acumular(*it);
+    });
+    printf("%-7s | %-8s | %7zu | %13.2f | %13.2f | %9.2f | %13.2f  (%.0f)\n",
+           tipo, layout, tamanhoNo, pedidos, reservados, pushMs, travessiaMs, soma);
+}
+
+template <typename T>
+void medirTipo(const char* tipo, int n) {
+    medir<DoublyLinkedList<T>, T>(tipo, "ponteiro", sizeof(Node<T>), n);
+    medir<CompactDoublyLinkedList<T>, T>(tipo, "compacto", sizeof(CompactSlot<T>), n);
+}
+
+int main(int argc, char* argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    if (n <= 0)
+        n = 1;
+    printf("%d elementos; tempos em ms\n", n);
+    printf("%-7s | %-8s | %7s | %13s | %13s | %9s | %13s\n",
+           "tipo", "layout", "sizeof", "pedidos/elem", "malloc/elem", "push", "travessia");
+    medirTipo<int>("int", n);
+    medirTipo<double>("double", n);
+    medirTipo<string>("string", n);
+    return 0;
+}
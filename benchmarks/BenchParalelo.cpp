@@ -0,0 +1,134 @@
+/*
+Benchmark de escalabilidade dos algoritmos paralelos (ListaParalelaDE.h)
+contra o caminho sequencial, com 1 até N threads:
+  - sort: DoublyLinkedList::sort contra parallelSort;
+  - for_each, reduce, count e find (último elemento): um percurso com
+    iteradores contra parallelForEach, parallelReduce, parallelCountIf e
+    parallelFind.
+Os resultados paralelos são comparados com os sequenciais; em caso de
+divergência o programa termina com código 1.
+Uso: ./bench_paralelo [threads máx.] [elementos]
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../ListaParalelaDE.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+typedef DoublyLinkedList<long long> Lista;
+
+// Trabalho por elemento do for_each, para que o percurso não seja só
+// limitado pela memória.
+struct Trabalho {
+    void operator()(long long& x) const {
+        x = static_cast<long long>(sqrt(static_cast<double>(x) * 3.0 + 1.0));
+    }
+};
+
+template <typename Funcao>
+double medirMs(Funcao f) {
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+}
+
+void preencher(Lista& lista, const vector<long long>& valores) {
+    lista.clear();
+    lista.pushRange(valores.begin(), valores.end());
+}
+
+// Sequência de referência do caminho sequencial.
+struct Referencia {
+    double sortMs, forEachMs, reduceMs, countMs, findMs;
+    vector<long long> ordenados, transformados;
+    long long soma;
+    int pares;
+    int posicaoEncontrada;
+};
+
+Referencia medirSequencial(const vector<long long>& valores) {
+    Referencia r;
+    Lista lista;
+    preencher(lista, valores);
+    r.sortMs = medirMs([&] { lista.sort(); });
+    r.ordenados.assign(lista.begin(), lista.end());
+
+    preencher(lista, valores);
+    r.forEachMs = medirMs([&] { for_each(lista.begin(), lista.end(), Trabalho()); });
+    r.transformados.assign(lista.begin(), lista.end());
+
+    r.reduceMs = medirMs([&] {
+        r.soma = 0;
+        for (Lista::const_iterator it = lista.begin(); it != lista.end(); ++it)
+            r.soma += *it;
+    });
+    r.countMs = medirMs([&] {
+        r.pares = static_cast<int>(count_if(lista.begin(), lista.end(), [](long long x) { return x % 2 == 0; }));
+    });
+    long long ultimo = lista.length() > 0 ? *lista.rbegin() : 0;
+    r.findMs = medirMs([&] {
+        r.posicaoEncontrada = static_cast<int>(distance(lista.begin(), find(lista.begin(), lista.end(), ultimo)));
+    });
+    return r;
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = (argc > 1) ? atoi(argv[1]) : static_cast<int>(thread::hardware_concurrency());
+    int n = (argc > 2) ? atoi(argv[2]) : 2000000;
+    if (maxThreads < 1)
+        maxThreads = 1;
+
+    mt19937_64 rng(42);
+    vector<long long> valores(n);
+    for (int i = 0; i < n; i++)
+        valores[i] = static_cast<long long>(rng() % 1000000000ULL);
+
+    Referencia seq = medirSequencial(valores);
+    printf("%d elementos; tempos em ms (speedup sobre o sequencial)\n", n);
+    printf("%8s | %16s | %16s | %16s | %16s | %16s\n", "threads", "sort", "for_each", "reduce", "count", "find");
+    printf("%8s | %16.2f | %16.2f | %16.2f | %16.2f | %16.2f\n", "seq", seq.sortMs, seq.forEachMs, seq.reduceMs,
+           seq.countMs, seq.findMs);
+
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        unsigned threads = static_cast<unsigned>(t);
+        Lista lista;
+        preencher(lista, valores);
+        double sortMs = medirMs([&] { parallelSort(lista, less<long long>(), threads); });
+        bool ok = equal(seq.ordenados.begin(), seq.ordenados.end(), lista.begin());
+
+        preencher(lista, valores);
+        double forEachMs = medirMs([&] { parallelForEach(lista, Trabalho(), threads); });
+        ok = ok && equal(seq.transformados.begin(), seq.transformados.end(), lista.begin());
+
+        long long soma = 0;
+        double reduceMs = medirMs([&] { soma = parallelReduce(lista, 0LL, plus<long long>(), threads); });
+        int pares = 0;
+        double countMs = medirMs([&] {
+            pares = parallelCountIf(lista, [](long long x) { return x % 2 == 0; }, threads);
+        });
+        long long ultimo = lista.length() > 0 ? *lista.rbegin() : 0;
+        Lista::iterator encontrado;
+        double findMs = medirMs([&] { encontrado = parallelFind(lista, ultimo, threads); });
+        ok = ok && soma == seq.soma && pares == seq.pares &&
+             distance(lista.begin(), encontrado) == seq.posicaoEncontrada;
+        if (!ok) {
+            printf("Resultado divergente do sequencial com %d threads.\n", t);
+            return 1;
+        }
+
+        printf("%8d | %8.2f (%4.1fx) | %8.2f (%4.1fx) | %8.2f (%4.1fx) | %8.2f (%4.1fx) | %8.2f (%4.1fx)\n", t,
+               sortMs, seq.sortMs / sortMs, forEachMs, seq.forEachMs / forEachMs, reduceMs, seq.reduceMs / reduceMs,
+               countMs, seq.countMs / countMs, findMs, seq.findMs / findMs);
+        if (t < maxThreads && t * 2 > maxThreads)
+            t = maxThreads / 2; // Garante uma rodada com maxThreads
+    }
+    printf("Verificação contra o sequencial: ok\n");
+    return 0;
+}
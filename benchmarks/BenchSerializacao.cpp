@@ -0,0 +1,88 @@
+/*
+Benchmark da serialização binária (ListaSerializacaoDE.h) contra a
+abordagem em texto: gravar com get(i) e operator<< e reconstruir lendo
+o texto com push, para listas de int e de string.
+Após cada carga verifica que a lista lida é igual à original; em caso
+de divergência o programa termina com código 1.
+Uso: ./bench_serializacao [elementos] [diretório temporário]
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../ListaSerializacaoDE.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+template <typename F>
+double medirMs(F f) {
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+}
+
+// Abordagem em texto: um valor por linha, gravado com get(i).
+template <typename T>
+void salvarTexto(const DoublyLinkedList<T>& lista, const string& caminho) {
+    ofstream out(caminho.c_str());
+    for (int i = 0; i < lista.length(); i++)
+        out << lista.get(i) << '\n';
+}
+
+template <typename T>
+void carregarTexto(DoublyLinkedList<T>& lista, const string& caminho) {
+    ifstream in(caminho.c_str());
+    lista.clear();
+    T valor;
+    while (in >> valor)
+        lista.push(valor);
+}
+
+template <typename T>
+bool medir(const char* tipo, const DoublyLinkedList<T>& original, const string& diretorio, bool comTexto) {
+    string texto = diretorio + "/bench_lista.txt";
+    string binario = diretorio + "/bench_lista.bin";
+    DoublyLinkedList<T> lida;
+
+    double salvarBinMs = medirMs([&] { save(original, binario); });
+    double carregarBinMs = medirMs([&] { load(lida, binario); });
+    bool ok = lida.length() == original.length() && equal(original.begin(), original.end(), lida.begin());
+    printf("%-8s | %-7s | %12.2f | %12.2f\n", tipo, "binário", salvarBinMs, carregarBinMs);
+
+    if (comTexto) {
+        double salvarTxtMs = medirMs([&] { salvarTexto(original, texto); });
+        double carregarTxtMs = medirMs([&] { carregarTexto(lida, texto); });
+        ok = ok && lida.length() == original.length() && equal(original.begin(), original.end(), lida.begin());
+        printf("%-8s | %-7s | %12.2f | %12.2f\n", tipo, "texto", salvarTxtMs, carregarTxtMs);
+    }
+    remove(texto.c_str());
+    remove(binario.c_str());
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    string diretorio = (argc > 2) ? argv[2] : ".";
+    // O texto com get(i) é O(N²): só roda para listas pequenas
+    bool comTexto = n <= 50000;
+
+    DoublyLinkedList<int> inteiros;
+    DoublyLinkedList<string> strings;
+    for (int i = 0; i < n; i++) {
+        inteiros.push(i * 7);
+        strings.push("elemento_" + to_string(i));
+    }
+
+    printf("%d elementos; tempos em ms%s\n", n, comTexto ? "" : " (texto omitido: O(N²) com N > 50000)");
+    printf("%-8s | %-7s | %12s | %12s\n", "tipo", "formato", "save", "load");
+    bool ok = medir("int", inteiros, diretorio, comTexto) && medir("string", strings, diretorio, comTexto);
+    if (!ok) {
+        printf("Lista lida diferente da original.\n");
+        return 1;
+    }
+    printf("Verificação das listas lidas: ok\n");
+    return 0;
+}
@@ -0,0 +1,371 @@
+/*
+Suíte de benchmarks da DoublyLinkedList para acompanhar regressões.
+Mede, para cada tamanho N e tipo de elemento (int, string pequena e
+string grande), o tempo médio por operação de:
+  - push e pushFirst (construção da lista com N elementos);
+  - operator[] em posições aleatórias e em posições consecutivas a
+    partir do meio da lista (laço for com list[i]);
+  - popByValue seguido de push (operações baseadas em getNodeByValue);
+  - move entre posições aleatórias;
+  - insertAt e popAt em posições aleatórias;
+  - deslocate entre duas listas;
+  - sort estável de N elementos embaralhados (std::stable_sort em
+    std::deque e std::vector).
+As mesmas operações rodam sobre a DoublyLinkedList (padrão, com o
+HashValueIndex e com a CountingInstrumentation, para medir o custo das
+métricas) e, para comparação, sobre std::list, std::deque e
+std::vector. Além disso mede indexOf e count da UnrolledDoublyLinkedList
+com int, float e double em cada nível de busca vetorial (escalar, SSE2
+e AVX2, conforme o processador) e resume os ganhos sobre o escalar na
+saída de erro. O resultado é escrito em JSON (um objeto por medição) na
+saída padrão ou no arquivo informado.
+Uso: ./bench_suite [N máximo] [arquivo.json]  (padrão 10^5, saída padrão)
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../ListaDesenroladaDE.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+// Mede o tempo de execução de f em milissegundos.
+template <typename F>
+double medirMs(F f) {
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    f();
+    chrono::steady_clock::time_point fim = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(fim - inicio).count();
+}
+
+// Geradores de valores: cada um define o tipo e o nome usado no JSON.
+struct GeradorInt {
+    typedef int Tipo;
+    static const char* nome() { return "int"; }
+    static int gerar(int i) { return i; }
+};
+
+struct GeradorFloat {
+    typedef float Tipo;
+    static const char* nome() { return "float"; }
+    static float gerar(int i) { return static_cast<float>(i) * 0.5f; }
+};
+
+struct GeradorDouble {
+    typedef double Tipo;
+    static const char* nome() { return "double"; }
+    static double gerar(int i) { return static_cast<double>(i) * 0.25; }
+};
+
+struct GeradorStringPequena {
+    typedef string Tipo;
+    static const char* nome() { return "string_pequena"; }
+    static string gerar(int i) { return "s" + to_string(i); }   // Cabe no SSO
+};
+
+struct GeradorStringGrande {
+    typedef string Tipo;
+    static const char* nome() { return "string_grande"; }
+    static string gerar(int i) { return to_string(i) + string(256, 'x'); }
+};
+
+/*---------------------------------------------------------------
+ * Adaptadores: expõem a mesma interface para todos os contêineres.
+ * O padrão atende à DoublyLinkedList; std::list, std::deque e
+ * std::vector têm especializações parciais abaixo.
+ *---------------------------------------------------------------*/
+template <typename Conteiner>
+struct Adaptador {
+    typedef typename Conteiner::iterator::value_type T;
+
+    static void push(Conteiner& c, const T& v) { c.push(v); }
+    static void pushFirst(Conteiner& c, const T& v) { c.pushFirst(v); }
+    static void insertAt(Conteiner& c, int i, const T& v) { c.insertAt(i, v); }
+    static T popAt(Conteiner& c, int i) { return c.popAt(i); }
+    static void move(Conteiner& c, int i, int j) { c.move(i, j); }
+    static void deslocate(Conteiner& origem, Conteiner& destino, int i, int j) { ::deslocate(origem, destino, i, j); }
+    static void popByValue(Conteiner& c, const T& v) { c.popByValue(v); }
+    static const T& get(const Conteiner& c, int i) { return c[i]; }
+    static void sort(Conteiner& c) { c.sort(); }
+};
+
+// Operações posicionais genéricas para os contêineres da biblioteca padrão.
+template <typename Conteiner>
+struct AdaptadorStd {
+    typedef typename Conteiner::value_type T;
+
+    static typename Conteiner::iterator posicao(Conteiner& c, int i) {
+        return std::next(c.begin(), i);
+    }
+
+    static void push(Conteiner& c, const T& v) { c.push_back(v); }
+    static void insertAt(Conteiner& c, int i, const T& v) { c.insert(posicao(c, i), v); }
+    static void insertAt(Conteiner& c, int i, T&& v) { c.insert(posicao(c, i), std::move(v)); }
+
+    static T popAt(Conteiner& c, int i) {
+        typename Conteiner::iterator it = posicao(c, i);
+        T valor(std::move(*it));
+        c.erase(it);
+        return valor;
+    }
+
+    // Mesma semântica de DoublyLinkedList::move: j é contado antes da remoção
+    static void move(Conteiner& c, int i, int j) {
+        if (i < j)
+            j--;
+        T valor = popAt(c, i);
+        insertAt(c, j, std::move(valor));
+    }
+
+    static void deslocate(Conteiner& origem, Conteiner& destino, int i, int j) {
+        T valor = popAt(origem, i);
+        insertAt(destino, j, std::move(valor));
+    }
+
+    static void popByValue(Conteiner& c, const T& v) {
+        c.erase(std::find(c.begin(), c.end(), v));
+    }
+
+    static const T& get(const Conteiner& c, int i) { return *std::next(c.begin(), i); }
+    static void sort(Conteiner& c) { std::stable_sort(c.begin(), c.end()); }
+};
+
+template <typename T>
+struct Adaptador<list<T> > : AdaptadorStd<list<T> > {
+    static void pushFirst(list<T>& c, const T& v) { c.push_front(v); }
+
+    // std::list religa os nós com splice, como a DoublyLinkedList.
+    static void move(list<T>& c, int i, int j) {
+        c.splice(std::next(c.begin(), j), c, std::next(c.begin(), i));
+    }
+
+    static void deslocate(list<T>& origem, list<T>& destino, int i, int j) {
+        destino.splice(std::next(destino.begin(), j), origem, std::next(origem.begin(), i));
+    }
+
+    static void sort(list<T>& c) { c.sort(); }
+};
+
+template <typename T>
+struct Adaptador<deque<T> > : AdaptadorStd<deque<T> > {
+    static void pushFirst(deque<T>& c, const T& v) { c.push_front(v); }
+    static const T& get(const deque<T>& c, int i) { return c[i]; }
+};
+
+template <typename T>
+struct Adaptador<vector<T> > : AdaptadorStd<vector<T> > {
+    static void pushFirst(vector<T>& c, const T& v) { c.insert(c.begin(), v); }
+    static const T& get(const vector<T>& c, int i) { return c[i]; }
+};
+
+// Lê o valor para que o acesso não seja descartado pelo compilador.
+size_t consumir(int v) { return static_cast<size_t>(v); }
+size_t consumir(const string& s) { return s.size(); }
+
+// Acumula as medições e as escreve como um vetor JSON.
+class SaidaJson {
+private:
+    FILE* arquivo;
+    bool primeiro;
+
+public:
+    explicit SaidaJson(FILE* f) : arquivo(f), primeiro(true) {
+        fprintf(arquivo, "[\n");
+    }
+
+    ~SaidaJson() {
+        fprintf(arquivo, "\n]\n");
+    }
+
+    void registrar(const char* conteiner, const char* tipo, int n, const char* operacao, int ops, double ms) {
+        fprintf(arquivo, "%s  {\"conteiner\": \"%s\", \"tipo\": \"%s\", \"n\": %d, \"operacao\": \"%s\", "
+                         "\"ops\": %d, \"ns_por_op\": %.2f}",
+                primeiro ? "" : ",\n", conteiner, tipo, n, operacao, ops, ms * 1e6 / ops);
+        fflush(arquivo);
+        primeiro = false;
+    }
+};
+
+// Executa todas as operações sobre um contêiner com N elementos.
+template <typename Conteiner, typename Gerador>
+void medirConteiner(SaidaJson& saida, const char* nome, int n, int ops) {
+    typedef Adaptador<Conteiner> A;
+    typedef typename Gerador::Tipo T;
+    const char* tipo = Gerador::nome();
+
+    vector<T> valores;
+    valores.reserve(n);
+    for (int i = 0; i < n; i++)
+        valores.push_back(Gerador::gerar(i));
+
+    mt19937 rng(12345);
+    vector<int> posicoes(ops), destinos(ops);
+    for (int i = 0; i < ops; i++) {
+        posicoes[i] = static_cast<int>(rng() % (n - ops));
+        destinos[i] = static_cast<int>(rng() % (n - ops));
+    }
+
+    {
+        Conteiner c;
+        saida.registrar(nome, tipo, n, "push", n, medirMs([&] {
+            for (int i = 0; i < n; i++)
+                A::push(c, valores[i]);
+        }));
+    }
+    Conteiner c;
+    saida.registrar(nome, tipo, n, "pushFirst", n, medirMs([&] {
+        for (int i = 0; i < n; i++)
+            A::pushFirst(c, valores[i]);
+    }));
+
+    volatile size_t soma = 0;
+    saida.registrar(nome, tipo, n, "operator[]", ops, medirMs([&] {
+        for (int i = 0; i < ops; i++)
+            soma += consumir(A::get(c, posicoes[i]));
+    }));
+
+    saida.registrar(nome, tipo, n, "operator[] sequencial", ops, medirMs([&] {
+        for (int i = 0; i < ops; i++)
+            soma += consumir(A::get(c, (n / 2 + i) % n));
+    }));
+
+    // Cada valores[k] está na lista exatamente uma vez neste ponto
+    saida.registrar(nome, tipo, n, "popByValue+push", ops, medirMs([&] {
+        for (int i = 0; i < ops; i++) {
+            const T& v = valores[posicoes[i]];
+            A::popByValue(c, v);
+            A::push(c, v);
+        }
+    }));
+
+    saida.registrar(nome, tipo, n, "move", ops, medirMs([&] {
+        for (int i = 0; i < ops; i++)
+            A::move(c, posicoes[i], destinos[i]);
+    }));
+
+    saida.registrar(nome, tipo, n, "insertAt", ops, medirMs([&] {
+        for (int i = 0; i < ops; i++)
+            A::insertAt(c, posicoes[i], valores[i]);
+    }));
+
+    saida.registrar(nome, tipo, n, "popAt", ops, medirMs([&] {
+        for (int i = 0; i < ops; i++)
+            A::popAt(c, posicoes[i]);
+    }));
+
+
+    Conteiner outro;
+    for (int i = 0; i < n; i++)
+        A::push(outro, valores[i]);
+    saida.registrar(nome, tipo, n, "deslocate", ops, medirMs([&] {
+        for (int i = 0; i < ops; i++) {
+            if (i & 1)
+                A::deslocate(outro, c, posicoes[i], destinos[i]);
+            else
+                A::deslocate(c, outro, posicoes[i], destinos[i]);
+        }
+    }));
+
+    // Ordenação estável de N elementos em ordem aleatória
+    vector<T> embaralhados(valores);
+    shuffle(embaralhados.begin(), embaralhados.end(), rng);
+    Conteiner desordenado;
+    for (int i = 0; i < n; i++)
+        A::push(desordenado, embaralhados[i]);
+    saida.registrar(nome, tipo, n, "sort", n, medirMs([&] {
+        A::sort(desordenado);
+    }));
+}
+
+// Busca por valor na lista desenrolada em cada nível de SIMD disponível.
+// Procura valores em posições aleatórias (indexOf) e conta ocorrências
+// (count, percorre a lista inteira).
+template <typename Gerador>
+void medirBuscaVetorial(SaidaJson& saida, int n, int ops) {
+    typedef typename Gerador::Tipo T;
+    const int BlockSize = 64;
+    const char* tipo = Gerador::nome();
+    UnrolledDoublyLinkedList<T, BlockSize> lista;
+    for (int i = 0; i < n; i++)
+        lista.push(Gerador::gerar(i));
+    mt19937 rng(12345);
+    vector<T> buscados(ops);
+    for (int i = 0; i < ops; i++)
+        buscados[i] = Gerador::gerar(static_cast<int>(rng() % n));
+
+    SimdLevel original = simdLevel();
+    double escalarIndexOf = 0, escalarCount = 0;
+    for (int nivel = SimdScalar; nivel <= detectSimdLevel(); nivel++) {
+        setSimdLevel(static_cast<SimdLevel>(nivel));
+        string nome = string("UnrolledDoublyLinkedList<64>/") + simdLevelName(simdLevel());
+        volatile long long soma = 0;
+        double indexOfMs = medirMs([&] {
+            for (int i = 0; i < ops; i++)
+                soma += lista.indexOf(buscados[i]);
+        });
+        int contagens = ops / 10 + 1;
+        double countMs = medirMs([&] {
+            for (int i = 0; i < contagens; i++)
+                soma += lista.count(buscados[i]);
+        });
+        saida.registrar(nome.c_str(), tipo, n, "indexOf", ops, indexOfMs);
+        saida.registrar(nome.c_str(), tipo, n, "count", contagens, countMs);
+        if (nivel == SimdScalar) {
+            escalarIndexOf = indexOfMs;
+            escalarCount = countMs;
+        } else {
+            fprintf(stderr, "%-7s n=%-8d %-7s indexOf %.2fx  count %.2fx sobre o escalar\n", tipo, n,
+                    simdLevelName(simdLevel()), escalarIndexOf / indexOfMs, escalarCount / countMs);
+        }
+    }
+    setSimdLevel(original);
+}
+
+template <typename Gerador>
+void medirTipo(SaidaJson& saida, int n, int ops) {
+    typedef typename Gerador::Tipo T;
+    medirConteiner<DoublyLinkedList<T>, Gerador>(saida, "DoublyLinkedList", n, ops);
+    medirConteiner<DoublyLinkedList<T, HeapNodeAllocator<T>, HashValueIndex<T> >, Gerador>(
+        saida, "DoublyLinkedList+HashValueIndex", n, ops);
+    medirConteiner<DoublyLinkedList<T, HeapNodeAllocator<T>, NoValueIndex<T>, CountingInstrumentation>, Gerador>(
+        saida, "DoublyLinkedList+CountingInstrumentation", n, ops);
+    medirConteiner<list<T>, Gerador>(saida, "std::list", n, ops);
+    medirConteiner<deque<T>, Gerador>(saida, "std::deque", n, ops);
+    medirConteiner<vector<T>, Gerador>(saida, "std::vector", n, ops);
+}
+
+int main(int argc, char* argv[]) {
+    long long limite = (argc > 1) ? atoll(argv[1]) : 100000LL;
+    FILE* arquivo = stdout;
+    if (argc > 2) {
+        arquivo = fopen(argv[2], "w");
+        if (arquivo == nullptr) {
+            fprintf(stderr, "Não foi possível abrir %s para escrita.\n", argv[2]);
+            return 1;
+        }
+    }
+
+    {
+        SaidaJson saida(arquivo);
+        for (long long n = 1000; n <= limite; n *= 10) {
+            // Operações posicionais custam O(N) nas listas: menos operações nos tamanhos grandes
+            int ops = static_cast<int>(n >= 100000 ? 1000 : n >= 10000 ? 2000 : n / 4);
+            medirTipo<GeradorInt>(saida, static_cast<int>(n), ops);
+            medirTipo<GeradorStringPequena>(saida, static_cast<int>(n), ops);
+            medirTipo<GeradorStringGrande>(saida, static_cast<int>(n), ops);
+            medirBuscaVetorial<GeradorInt>(saida, static_cast<int>(n), ops);
+            medirBuscaVetorial<GeradorFloat>(saida, static_cast<int>(n), ops);
+            medirBuscaVetorial<GeradorDouble>(saida, static_cast<int>(n), ops);
+        }
+    }
+    if (arquivo != stdout)
+        fclose(arquivo);
+    return 0;
+}
@@ -0,0 +1,196 @@
+/*
+Benchmark dos snapshots da lista versionada (ListaVersionadaDE.h): um
+escritor executa insertAt, popAt e move enquanto L leitores leem a
+lista com get. Três abordagens:
+  - mutex: DoublyLinkedList com um mutex; os leitores travam a lista
+    durante as leituras (bloqueando o escritor);
+  - cópia: os leitores travam apenas para copiar a lista inteira e leem
+    a cópia;
+  - snapshot: VersionedDoublyLinkedList; cada leitura obtém um snapshot
+    em O(1), sem travas.
+Cada leitor, a cada rodada, faz 'leituras' gets em posições aleatórias
+de uma mesma visão e, a cada 16 rodadas, percorre a visão inteira
+verificando que ela é consistente: o escritor mantém os valores
+0..N-1 (um a mais entre um insertAt e o popAt seguinte). Em caso de
+inconsistência o programa termina com código 1.
+Uso: ./bench_versoes [leitores] [elementos] [operações do escritor] [leituras]
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../ListaVersionadaDE.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Verifica uma visão com n ou n + 1 elementos: percorre contando e, com
+// exatamente n elementos, confere a soma de 0..n-1.
+template <typename Visao>
+bool consistente(const Visao& visao, int n) {
+    int quantidade = 0;
+    long long soma = 0;
+    for (typename Visao::const_iterator it = visao.begin(); it != visao.end(); ++it) {
+        soma += *it;
+        quantidade++;
+    }
+    if (quantidade != visao.length())
+        return false;
+    if (quantidade == n)
+        return soma == static_cast<long long>(n) * (n - 1) / 2;
+    return quantidade == n + 1;
+}
+
+// Lê 'leituras' posições aleatórias da visão.
+template <typename Visao>
+long long ler(const Visao& visao, int leituras, mt19937& rng) {
+    long long soma = 0;
+    for (int k = 0; k < leituras; k++)
+        soma += visao.get(static_cast<int>(rng() % visao.length()));
+    return soma;
+}
+
+// Alterações do escritor: um move ou um insertAt seguido do popAt do
+// mesmo elemento. Retorna o número de alterações feitas.
+template <typename Lista>
+int escrever(Lista& lista, int n, mt19937& rng) {
+    if (rng() & 1) {
+        lista.move(static_cast<int>(rng() % n), static_cast<int>(rng() % n));
+        return 1;
+    }
+    int posicao = static_cast<int>(rng() % (n + 1));
+    lista.insertAt(posicao, n);
+    lista.popAt(posicao);
+    return 2;
+}
+
+// Resultado de uma rodada: alterações do escritor e leituras (gets) por
+// segundo, somadas entre os leitores.
+struct Resultado {
+    double escritasPorSegundo;
+    double leiturasPorSegundo;
+    bool ok;
+};
+
+// Abordagens com DoublyLinkedList e mutex.
+struct ListaComMutex {
+    DoublyLinkedList<long long> lista;
+    mutex m;
+    bool copiar;  // true: o leitor copia a lista sob a trava e lê a cópia
+
+    bool rodadaLeitor(int n, int leituras, bool verificar, mt19937& rng, long long& soma) {
+        if (copiar) {
+            DoublyLinkedList<long long> copia;
+            {
+                lock_guard<mutex> g(m);
+                copia = lista;
+            }
+            soma += ler(copia, leituras, rng);
+            return !verificar || consistente(copia, n);
+        }
+        lock_guard<mutex> g(m);
+        soma += ler(lista, leituras, rng);
+        return !verificar || consistente(lista, n);
+    }
+
+    int rodadaEscritor(int n, mt19937& rng) {
+        lock_guard<mutex> g(m);
+        return escrever(lista, n, rng);
+    }
+};
+
+struct ListaComSnapshots {
+    VersionedDoublyLinkedList<long long> lista;
+
+    bool rodadaLeitor(int n, int leituras, bool verificar, mt19937& rng, long long& soma) {
+        ListSnapshot<long long> visao = lista.snapshot();
+        soma += ler(visao, leituras, rng);
+        return !verificar || consistente(visao, n);
+    }
+
+    int rodadaEscritor(int n, mt19937& rng) {
+        return escrever(lista, n, rng);
+    }
+};
+
+template <typename Abordagem>
+Resultado rodada(Abordagem& abordagem, int leitores, int n, int operacoes, int leituras) {
+    atomic<bool> terminou(false);
+    atomic<bool> falhou(false);
+    vector<long long> lidas(leitores, 0);
+    vector<long long> somas(leitores, 0);
+    vector<thread> threads;
+
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    for (int t = 0; t < leitores; t++) {
+        threads.push_back(thread([&, t] {
+            mt19937 rng(static_cast<unsigned>(t + 1));
+            for (long long r = 0; !terminou.load(memory_order_relaxed); r++) {
+                if (!abordagem.rodadaLeitor(n, leituras, (r % 16) == 0, rng, somas[t]))
+                    falhou.store(true);
+                lidas[t] += leituras;
+            }
+        }));
+    }
+    mt19937 rng(12345);
+    long long escritas = 0;
+    for (int k = 0; k < operacoes; k++)
+        escritas += abordagem.rodadaEscritor(n, rng);
+    double segundosEscritor = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    terminou.store(true);
+    for (size_t t = 0; t < threads.size(); t++)
+        threads[t].join();
+
+    long long totalLidas = 0;
+    for (int t = 0; t < leitores; t++)
+        totalLidas += lidas[t];
+    Resultado resultado = {escritas / segundosEscritor, totalLidas / segundosEscritor, !falhou.load()};
+    return resultado;
+}
+
+int main(int argc, char* argv[]) {
+    int leitores = (argc > 1) ? atoi(argv[1]) : 4;
+    int n = (argc > 2) ? atoi(argv[2]) : 10000;
+    int operacoes = (argc > 3) ? atoi(argv[3]) : 20000;
+    int leituras = (argc > 4) ? atoi(argv[4]) : 32;
+    if (leitores < 1)
+        leitores = 1;
+    if (n < 2)
+        n = 2;
+
+    ListaComMutex comMutex;
+    ListaComMutex comCopia;
+    ListaComSnapshots comSnapshots;
+    comMutex.copiar = false;
+    comCopia.copiar = true;
+    for (int i = 0; i < n; i++) {
+        comMutex.lista.push(i);
+        comCopia.lista.push(i);
+        comSnapshots.lista.push(i);
+    }
+
+    printf("%d leitores, %d elementos, %d operações do escritor, %d leituras por visão\n",
+           leitores, n, operacoes, leituras);
+    printf("%-9s | %18s | %18s\n", "abordagem", "escritas/s", "leituras/s");
+    Resultado resultados[3] = {
+        rodada(comMutex, leitores, n, operacoes, leituras),
+        rodada(comCopia, leitores, n, operacoes, leituras),
+        rodada(comSnapshots, leitores, n, operacoes, leituras)
+    };
+    const char* nomes[3] = {"mutex", "cópia", "snapshot"};
+    bool ok = true;
+    for (int i = 0; i < 3; i++) {
+        printf("%-9s | %18.0f | %18.0f\n", nomes[i], resultados[i].escritasPorSegundo, resultados[i].leiturasPorSegundo);
+        ok = ok && resultados[i].ok;
+    }
+    if (!ok) {
+        printf("Visão inconsistente observada por um leitor.\n");
+        return 1;
+    }
+    printf("Verificação das visões: ok\n");
+    return 0;
+}
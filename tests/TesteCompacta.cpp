@@ -0,0 +1,282 @@
+/*
+Teste da lista compacta (ListaCompactaDE.h):
+  - sequências aleatórias de push/pushFirst/insertAt, popAt, move, sort,
+    merge, splice e deslocate (na mesma lista e entre duas listas) e
+    removeAll comparadas com um modelo (vector), conferindo os dois
+    sentidos de percurso;
+  - as posições liberadas (pela free-list ou por clear()) são reusadas
+    sem aumentar o vetor;
+  - inserções que fazem o vetor crescer com o argumento sendo um
+    elemento da própria lista (push, insertAt, emplace, push(refValue,
+    side), emplace_back).
+Os valores são strings longas, para que um acesso a um elemento já
+movido ou destruído apareça como diferença em relação ao modelo.
+*/
+
+#include "../ListaCompactaDE.h"
+#include "Verificacao.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+typedef CompactDoublyLinkedList<string> Lista;
+typedef vector<string> Modelo;
+
+static void verificar(const Lista& lista, const Modelo& modelo) {
+    VERIFICA(lista.length() == static_cast<int>(modelo.size()));
+    VERIFICA(Modelo(lista.cbegin(), lista.cend()) == modelo);
+    VERIFICA(Modelo(lista.crbegin(), lista.crend()) == Modelo(modelo.rbegin(), modelo.rend()));
+}
+
+static string valorAleatorio(mt19937& rng) {
+    return to_string(rng() % 20) + string(24, '#');
+}
+
+// Move [primeiro, ultimo) de 'origem' para antes de pos em 'destino'
+// (listas diferentes).
+static void spliceModelo(Modelo& destino, int pos, Modelo& origem, int primeiro, int ultimo) {
+    destino.insert(destino.begin() + pos, origem.begin() + primeiro, origem.begin() + ultimo);
+    origem.erase(origem.begin() + primeiro, origem.begin() + ultimo);
+}
+
+static void sequenciaAleatoria(unsigned semente) {
+    mt19937 rng(semente);
+    Lista a, b;
+    Modelo ma, mb;
+    for (int passo = 0; passo < 3000; passo++) {
+        int na = a.length();
+        int nb = b.length();
+        switch (rng() % 12) {
+        case 0: case 1: {
+            string valor = valorAleatorio(rng);
+            if (rng() % 2) {
+                a.push(valor);
+                ma.push_back(valor);
+            } else {
+                b.pushFirst(valor);
+                mb.insert(mb.begin(), valor);
+            }
+            break;
+        }
+        case 2: {
+            string valor = valorAleatorio(rng);
+            int pos = static_cast<int>(rng() % (na + 1));
+            a.insertAt(pos, valor);
+            ma.insert(ma.begin() + pos, valor);
+            break;
+        }
+        case 3: {
+            if (na == 0) {
+                VERIFICA_EXCECAO(a.popAt(0), out_of_range);
+                break;
+            }
+            int indice = static_cast<int>(rng() % na);
+            VERIFICA(a.popAt(indice) == ma[indice]);
+            ma.erase(ma.begin() + indice);
+            break;
+        }
+        case 4: {
+            if (na == 0)
+                break;
+            int indice = static_cast<int>(rng() % na);
+            int novo = static_cast<int>(rng() % na);
+            a.move(indice, novo);
+            string movido = ma[indice];
+            ma.erase(ma.begin() + indice);
+            ma.insert(ma.begin() + (indice < novo ? novo - 1 : novo), movido);
+            break;
+        }
+        case 5: {
+            a.sort();
+            b.sort();
+            sort(ma.begin(), ma.end());
+            sort(mb.begin(), mb.end());
+            Modelo esperado;
+            merge(ma.begin(), ma.end(), mb.begin(), mb.end(), back_inserter(esperado));
+            a.merge(b);
+            a.merge(a);
+            ma = esperado;
+            mb.clear();
+            break;
+        }
+        case 6: {
+            // Entre listas
+            int primeiro = static_cast<int>(rng() % (na + 1));
+            int ultimo = primeiro + static_cast<int>(rng() % (na - primeiro + 1));
+            int pos = static_cast<int>(rng() % (nb + 1));
+            VERIFICA_EXCECAO(splice(b, nb + 1, a, primeiro, ultimo), out_of_range);
+            VERIFICA_EXCECAO(splice(b, pos, a, 0, na + 1), out_of_range);
+            splice(b, pos, a, primeiro, ultimo);
+            spliceModelo(mb, pos, ma, primeiro, ultimo);
+            break;
+        }
+        case 7: {
+            // Na mesma lista
+            int primeiro = static_cast<int>(rng() % (na + 1));
+            int ultimo = primeiro + static_cast<int>(rng() % (na - primeiro + 1));
+            int pos = static_cast<int>(rng() % (na + 1));
+            if (pos > primeiro && pos < ultimo) {
+                VERIFICA_EXCECAO(splice(a, pos, a, primeiro, ultimo), invalid_argument);
+                break;
+            }
+            splice(a, pos, a, primeiro, ultimo);
+            Modelo intervalo(ma.begin() + primeiro, ma.begin() + ultimo);
+            if (pos >= ultimo) {
+                ma.insert(ma.begin() + pos, intervalo.begin(), intervalo.end());
+                ma.erase(ma.begin() + primeiro, ma.begin() + ultimo);
+            } else {
+                ma.erase(ma.begin() + primeiro, ma.begin() + ultimo);
+                ma.insert(ma.begin() + pos, intervalo.begin(), intervalo.end());
+            }
+            break;
+        }
+        case 8: {
+            if (nb == 0)
+                break;
+            int indice = static_cast<int>(rng() % nb);
+            int novo = static_cast<int>(rng() % (na + 1));
+            VERIFICA_EXCECAO(deslocate(b, a, indice, na + 1), out_of_range);
+            deslocate(b, a, indice, novo);
+            ma.insert(ma.begin() + novo, mb[indice]);
+            mb.erase(mb.begin() + indice);
+            break;
+        }
+        case 9: {
+            if (na == 0)
+                break;
+            int indice = static_cast<int>(rng() % na);
+            int novo = static_cast<int>(rng() % na);
+            VERIFICA_EXCECAO(deslocate(a, a, indice, na), out_of_range);
+            deslocate(a, a, indice, novo);
+            string movido = ma[indice];
+            ma.erase(ma.begin() + indice);
+            ma.insert(ma.begin() + novo, movido);
+            break;
+        }
+        case 10: {
+            if (na == 0)
+                break;
+            // O argumento é um elemento da própria lista
+            int indice = static_cast<int>(rng() % na);
+            string valor = ma[indice];
+            int removidos = static_cast<int>(count(ma.begin(), ma.end(), valor));
+            VERIFICA(a.removeAll(a[indice]) == removidos);
+            ma.erase(remove(ma.begin(), ma.end(), valor), ma.end());
+            VERIFICA(a.removeAll(valor) == 0);
+            break;
+        }
+        case 11: {
+            if (rng() % 8 == 0) {
+                b.clear();
+                mb.clear();
+            }
+            break;
+        }
+        }
+        verificar(a, ma);
+        verificar(b, mb);
+    }
+}
+
+// Posições liberadas voltam a ser usadas antes de o vetor crescer.
+static void reusoDePosicoes() {
+    Lista lista;
+    Modelo modelo;
+    for (int i = 0; i < 100; i++) {
+        lista.push(to_string(i));
+        modelo.push_back(to_string(i));
+    }
+    size_t memoria = lista.memoryUsage();
+
+    // Pela free-list
+    for (int rodada = 0; rodada < 10; rodada++) {
+        for (int i = 0; i < 30; i++) {
+            lista.popAt(i);
+            modelo.erase(modelo.begin() + i);
+        }
+        for (int i = 0; i < 30; i++) {
+            lista.insertAt(i * 2, "n" + to_string(i));
+            modelo.insert(modelo.begin() + i * 2, "n" + to_string(i));
+        }
+        VERIFICA(lista.memoryUsage() == memoria);
+    }
+    verificar(lista, modelo);
+
+    // Depois de clear()
+    for (int rodada = 0; rodada < 3; rodada++) {
+        lista.clear();
+        modelo.clear();
+        verificar(lista, modelo);
+        for (int i = 0; i < 100; i++) {
+            lista.pushFirst(string(30, static_cast<char>('a' + i % 26)));
+            modelo.insert(modelo.begin(), string(30, static_cast<char>('a' + i % 26)));
+        }
+        VERIFICA(lista.memoryUsage() == memoria);
+        verificar(lista, modelo);
+    }
+}
+
+// Inserções com argumento da própria lista enquanto o vetor cresce.
+static void crescimentoComAliasing() {
+    mt19937 rng(7);
+    Lista lista;
+    Modelo modelo;
+    lista.push(string(40, 'x'));
+    modelo.push_back(string(40, 'x'));
+    int crescimentos = 0;
+    while (lista.length() < 5000) {
+        size_t memoria = lista.memoryUsage();
+        int n = lista.length();
+        int indice = static_cast<int>(rng() % n);
+        switch (rng() % 5) {
+        case 0:
+            lista.push(lista[indice]);
+            modelo.push_back(modelo[indice]);
+            break;
+        case 1: {
+            int pos = static_cast<int>(rng() % (n + 1));
+            lista.insertAt(pos, lista[indice]);
+            modelo.insert(modelo.begin() + pos, modelo[indice]);
+            break;
+        }
+        case 2: {
+            Lista::const_iterator pos = lista.cbegin();
+            ++pos;
+            lista.emplace(pos, lista[indice]);
+            modelo.insert(modelo.begin() + 1, modelo[indice]);
+            break;
+        }
+        case 3: {
+            string valor = modelo[indice];
+            int primeiro = static_cast<int>(find(modelo.begin(), modelo.end(), valor) - modelo.begin());
+            lista.push(lista[indice], 'd');
+            modelo.insert(modelo.begin() + primeiro + 1, valor);
+            break;
+        }
+        case 4:
+            lista.emplace_back(lista[indice]);
+            modelo.push_back(modelo[indice]);
+            lista.set(0, to_string(n) + string(40, 'y'));
+            modelo[0] = to_string(n) + string(40, 'y');
+            break;
+        }
+        if (lista.memoryUsage() != memoria)
+            crescimentos++;
+        if (lista.length() % 500 == 0)
+            verificar(lista, modelo);
+    }
+    VERIFICA(crescimentos >= 10);
+    verificar(lista, modelo);
+}
+
+int main() {
+    for (unsigned semente = 1; semente <= 10; semente++)
+        sequenciaAleatoria(semente);
+    reusoDePosicoes();
+    crescimentoComAliasing();
+    printf("CompactDoublyLinkedList: ok\n");
+    return 0;
+}
@@ -0,0 +1,191 @@
+/*
+Teste da lista concorrente (ListaConcorrenteDE.h):
+  - deslocate e move dentro da mesma lista validam os dois índices e,
+    com um índice inválido, lançam out_of_range sem alterar a lista;
+  - estresse com várias threads executando insertAt, popAt, move,
+    push/pushFirst, pop/popFirst, popByValue e deslocate (na mesma lista
+    e entre duas listas, nos dois sentidos). Índices que deixam de
+    existir por ação de outra thread podem lançar out_of_range, mas sem
+    perder o elemento. Ao final (sem concorrência) verifica que:
+      * o conjunto de valores das duas listas é exatamente o inserido
+        menos o removido (nada perdido nem duplicado);
+      * length() bate com o percurso pelos ponteiros next (get) e com o
+        número de pop() (que segue os ponteiros prev a partir do fim).
+Uso: ./teste_concorrencia [threads] [operações por thread]
+*/
+
+#include "../ListaConcorrenteDE.h"
+#include "Verificacao.h"
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+typedef ConcurrentDoublyLinkedList<long long> Lista;
+
+vector<long long> valores(Lista& lista) {
+    vector<long long> resultado;
+    for (int i = 0; i < lista.length(); i++)
+        resultado.push_back(lista.get(i));
+    return resultado;
+}
+
+void indicesInvalidos() {
+    Lista lista;
+    for (int i = 0; i < 5; i++)
+        lista.push(i);
+    vector<long long> antes = valores(lista);
+    VERIFICA_EXCECAO(deslocate(lista, lista, 0, 999), out_of_range);
+    VERIFICA_EXCECAO(deslocate(lista, lista, 0, 5), out_of_range);
+    VERIFICA_EXCECAO(deslocate(lista, lista, 0, -1), out_of_range);
+    VERIFICA_EXCECAO(deslocate(lista, lista, 5, 0), out_of_range);
+    VERIFICA_EXCECAO(lista.move(0, 5), out_of_range);
+    VERIFICA(valores(lista) == antes);
+
+    // Mesma semântica da DoublyLinkedList: sem ajuste de newIndex
+    deslocate(lista, lista, 0, 4);
+    long long esperado[] = {1, 2, 3, 4, 0};
+    VERIFICA(valores(lista) == vector<long long>(esperado, esperado + 5));
+
+    Lista outra;
+    VERIFICA_EXCECAO(deslocate(lista, outra, 0, 1), out_of_range);
+    VERIFICA_EXCECAO(deslocate(lista, outra, 5, 0), out_of_range);
+    VERIFICA(valores(lista) == vector<long long>(esperado, esperado + 5));
+    VERIFICA(outra.length() == 0);
+}
+
+// Registro de uma thread: valores inseridos e removidos por ela.
+struct Registro {
+    vector<long long> inseridos;
+    vector<long long> removidos;
+};
+
+void trabalhador(int id, int operacoes, Lista* listas[2], Registro& registro) {
+    mt19937 rng(static_cast<unsigned>(id) * 7919u + 1u);
+    long long proximo = static_cast<long long>(id + 1) * 1000000000LL;
+    for (int k = 0; k < operacoes; k++) {
+        int a = static_cast<int>(rng() & 1);
+        Lista& lista = *listas[a];
+        Lista& outra = *listas[1 - a];
+        // Índices a partir de um instantâneo do tamanho (podem ficar
+        // inválidos, ou até ser inválidos de propósito: +2)
+        int n = lista.length();
+        int i = static_cast<int>(rng() % (n + 2));
+        int j = static_cast<int>(rng() % (n + 2));
+        // Listas grandes tornam os percursos lentos: favorece remoções
+        int op = static_cast<int>(rng() % 10);
+        if (n > 200 && op < 3)
+            op = 4;
+        try {
+            switch (op) {
+            case 0:
+                lista.insertAt(i, proximo);
+                registro.inseridos.push_back(proximo++);
+                break;
+            case 1:
+                lista.push(proximo);
+                registro.inseridos.push_back(proximo++);
+                break;
+            case 2:
+                lista.pushFirst(proximo);
+                registro.inseridos.push_back(proximo++);
+                break;
+            case 3:
+            case 4:
+                registro.removidos.push_back(lista.popAt(i));
+                break;
+            case 5:
+                lista.move(i, j);
+                break;
+            case 6:
+                deslocate(lista, lista, i, j);
+                break;
+            case 7:
+                deslocate(lista, outra, i, static_cast<int>(rng() % (outra.length() + 1)));
+                break;
+            case 8:
+                // Remove pelo valor um elemento que esta thread inseriu
+                if (!registro.inseridos.empty()) {
+                    long long v = registro.inseridos[rng() % registro.inseridos.size()];
+                    if (find(registro.removidos.begin(), registro.removidos.end(), v) == registro.removidos.end()) {
+                        lista.popByValue(v);
+                        registro.removidos.push_back(v);
+                    }
+                }
+                break;
+            case 9:
+                // pop/popFirst não devolvem o valor: lê e remove pelo valor
+                if (n > 0) {
+                    long long v = lista.get(rng() % n);
+                    lista.popByValue(v);
+                    registro.removidos.push_back(v);
+                }
+                break;
+            }
+        } catch (const out_of_range&) {
+            // Posição deixou de existir: nada foi alterado
+        } catch (const runtime_error&) {
+            // Valor já removido ou deslocado por outra thread
+        }
+    }
+}
+
+void estresse(int threads, int operacoes) {
+    Lista lista;
+    Lista outra;
+    Lista* listas[2] = {&lista, &outra};
+    vector<long long> iniciais;
+    for (long long v = 0; v < 100; v++) {
+        listas[v % 2]->push(v);
+        iniciais.push_back(v);
+    }
+
+    vector<Registro> registros(threads);
+    vector<thread> grupo;
+    for (int t = 0; t < threads; t++)
+        grupo.push_back(thread(trabalhador, t, operacoes, listas, std::ref(registros[t])));
+    for (size_t t = 0; t < grupo.size(); t++)
+        grupo[t].join();
+
+    // Valores esperados: iniciais + inseridos - removidos
+    vector<long long> esperado(iniciais);
+    vector<long long> removidos;
+    for (int t = 0; t < threads; t++) {
+        esperado.insert(esperado.end(), registros[t].inseridos.begin(), registros[t].inseridos.end());
+        removidos.insert(removidos.end(), registros[t].removidos.begin(), registros[t].removidos.end());
+    }
+    sort(esperado.begin(), esperado.end());
+    sort(removidos.begin(), removidos.end());
+    VERIFICA(adjacent_find(removidos.begin(), removidos.end()) == removidos.end()); // Nada removido duas vezes
+    vector<long long> restantes;
+    set_difference(esperado.begin(), esperado.end(), removidos.begin(), removidos.end(), back_inserter(restantes));
+    VERIFICA(restantes.size() + removidos.size() == esperado.size()); // Só remove o que existia
+
+    vector<long long> encontrados = valores(lista);
+    vector<long long> daOutra = valores(outra);
+    encontrados.insert(encontrados.end(), daOutra.begin(), daOutra.end());
+    sort(encontrados.begin(), encontrados.end());
+    VERIFICA(encontrados == restantes);
+
+    // Ponteiros prev: pop() a partir do fim remove exatamente length() nós
+    for (int l = 0; l < 2; l++) {
+        int n = listas[l]->length();
+        for (int k = 0; k < n; k++)
+            listas[l]->pop();
+        VERIFICA(listas[l]->length() == 0);
+        VERIFICA_EXCECAO(listas[l]->pop(), underflow_error);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int threads = (argc > 1) ? atoi(argv[1]) : 8;
+    int operacoes = (argc > 2) ? atoi(argv[2]) : 5000;
+    if (threads < 1)
+        threads = 1;
+    indicesInvalidos();
+    for (int rodada = 0; rodada < 5; rodada++)
+        estresse(threads, operacoes);
+    printf("ConcurrentDoublyLinkedList (%d threads): ok\n", threads);
+    return 0;
+}
@@ -0,0 +1,189 @@
+/*
+Teste da lista desenrolada (ListaDesenroladaDE.h): sequências aleatórias
+de push/pushFirst/insertAt, push(refValue, side), push(index, value, side),
+popByValue(value, side), pop(index, side), popAt, move, set e deslocate
+comparadas com um modelo (vector), com blocos pequenos para forçar
+divisões e fusões de blocos. Os valores de referência são tirados da
+própria lista (get devolve uma referência), e deslocate é exercitado com
+um tipo só movível.
+*/
+
+#include "../ListaDesenroladaDE.h"
+#include "Verificacao.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+typedef UnrolledDoublyLinkedList<string, 4> Lista;
+typedef vector<string> Modelo;
+
+static void verificar(const Lista& lista, const Modelo& modelo) {
+    VERIFICA(lista.length() == static_cast<int>(modelo.size()));
+    for (int i = 0; i < lista.length(); i++)
+        VERIFICA(lista[i] == modelo[i]);
+}
+
+static int primeiro(const Modelo& modelo, const string& valor) {
+    for (size_t i = 0; i < modelo.size(); i++)
+        if (modelo[i] == valor)
+            return static_cast<int>(i);
+    return -1;
+}
+
+static void sequenciaAleatoria(unsigned semente) {
+    mt19937 rng(semente);
+    Lista a, b;
+    Modelo ma, mb;
+    for (int passo = 0; passo < 4000; passo++) {
+        int n = a.length();
+        string valor = to_string(rng() % 50) + string(20, '#');
+        switch (rng() % 10) {
+        case 0:
+            a.push(valor);
+            ma.push_back(valor);
+            break;
+        case 1: {
+            int pos = static_cast<int>(rng() % (n + 1));
+            a.insertAt(pos, valor);
+            ma.insert(ma.begin() + pos, valor);
+            break;
+        }
+        case 2: {
+            if (n == 0) {
+                VERIFICA_EXCECAO(a.push(valor, 'd'), runtime_error);
+                a.pushFirst(valor);
+                ma.insert(ma.begin(), valor);
+                break;
+            }
+            // A referência aponta para um elemento da própria lista
+            int indice = static_cast<int>(rng() % n);
+            char lado = rng() % 2 ? 'd' : 'r';
+            int pos = primeiro(ma, ma[indice]) + (lado == 'd' ? 1 : 0);
+            a.push(a.get(indice), lado);
+            ma.insert(ma.begin() + pos, ma[indice]);
+            break;
+        }
+        case 3: {
+            VERIFICA_EXCECAO(a.push(n, valor, 'd'), out_of_range);
+            if (n == 0)
+                break;
+            VERIFICA_EXCECAO(a.push(0, valor, 'x'), invalid_argument);
+            int indice = static_cast<int>(rng() % n);
+            char lado = rng() % 2 ? 'd' : 'r';
+            a.push(indice, valor, lado);
+            ma.insert(ma.begin() + indice + (lado == 'd' ? 1 : 0), valor);
+            break;
+        }
+        case 4: {
+            if (n < 2) {
+                VERIFICA_EXCECAO(a.pop(0, 'd'), runtime_error);
+                break;
+            }
+            int indice = static_cast<int>(rng() % n);
+            char lado = rng() % 2 ? 'd' : 'r';
+            VERIFICA_EXCECAO(a.pop(n, lado), out_of_range);
+            if ((lado == 'd' && indice == n - 1) || (lado == 'r' && indice == 0)) {
+                VERIFICA_EXCECAO(a.pop(indice, lado), runtime_error);
+                break;
+            }
+            a.pop(indice, lado);
+            ma.erase(ma.begin() + indice + (lado == 'd' ? 1 : -1));
+            break;
+        }
+        case 5: {
+            if (n == 0)
+                break;
+            int indice = primeiro(ma, ma[rng() % n]);
+            char lado = rng() % 2 ? 'd' : 'r';
+            if ((lado == 'd' && indice == n - 1) || (lado == 'r' && indice == 0)) {
+                VERIFICA_EXCECAO(a.popByValue(ma[indice], lado), runtime_error);
+                break;
+            }
+            a.popByValue(a.get(indice), lado);
+            ma.erase(ma.begin() + indice + (lado == 'd' ? 1 : -1));
+            break;
+        }
+        case 6: {
+            if (n == 0)
+                break;
+            int indice = static_cast<int>(rng() % n);
+            VERIFICA(a.popAt(indice) == ma[indice]);
+            ma.erase(ma.begin() + indice);
+            break;
+        }
+        case 7: {
+            if (n == 0)
+                break;
+            int indice = static_cast<int>(rng() % n);
+            int novo = static_cast<int>(rng() % n);
+            a.move(indice, novo);
+            string movido = ma[indice];
+            ma.erase(ma.begin() + indice);
+            // Mesma semântica da DoublyLinkedList::move
+            ma.insert(ma.begin() + (indice < novo ? novo - 1 : novo), movido);
+            break;
+        }
+        case 8: {
+            if (n == 0)
+                break;
+            int indice = static_cast<int>(rng() % n);
+            a.set(indice, valor);
+            ma[indice] = valor;
+            a.get(indice) += "!";
+            ma[indice] += "!";
+            break;
+        }
+        case 9: {
+            if (n == 0)
+                break;
+            int indice = static_cast<int>(rng() % n);
+            int novo = static_cast<int>(rng() % (mb.size() + 1));
+            VERIFICA_EXCECAO(deslocate(a, b, indice, static_cast<int>(mb.size()) + 1), out_of_range);
+            deslocate(a, b, indice, novo);
+            mb.insert(mb.begin() + novo, ma[indice]);
+            ma.erase(ma.begin() + indice);
+            break;
+        }
+        }
+        verificar(a, ma);
+        verificar(b, mb);
+    }
+}
+
+struct SoMovivel {
+    int valor;
+
+    SoMovivel(int v) : valor(v) {}
+    SoMovivel(const SoMovivel&) = delete;
+    SoMovivel(SoMovivel&& other) : valor(other.valor) { other.valor = -1; }
+    SoMovivel& operator=(SoMovivel&& other) {
+        valor = other.valor;
+        other.valor = -1;
+        return *this;
+    }
+};
+
+static void deslocaSoMovivel() {
+    UnrolledDoublyLinkedList<SoMovivel, 4> origem, destino;
+    for (int i = 0; i < 10; i++)
+        origem.push(SoMovivel(i));
+    deslocate(origem, destino, 3, 0);
+    deslocate(origem, destino, 0, 1);
+    deslocate(origem, origem, 0, 7);
+    VERIFICA(origem.length() == 8);
+    VERIFICA(destino.length() == 2);
+    VERIFICA(destino[0].valor == 3);
+    VERIFICA(destino[1].valor == 0);
+    int esperado[] = {2, 4, 5, 6, 7, 8, 9, 1};
+    for (int i = 0; i < 8; i++)
+        VERIFICA(origem[i].valor == esperado[i]);
+}
+
+int main() {
+    for (unsigned semente = 1; semente <= 10; semente++)
+        sequenciaAleatoria(semente);
+    deslocaSoMovivel();
+    printf("UnrolledDoublyLinkedList: ok\n");
+    return 0;
+}
@@ -0,0 +1,370 @@
+/*
+Teste da lista estática (ListaEstaticaDE.h):
+  - iteradores: erase(end()) lança runtime_error, insert/emplace com a
+    lista cheia lançam length_error e o iterador padrão equivale a end();
+  - merge, splice (na mesma lista e entre listas de capacidades
+    diferentes), insertRange e emplace_back/emplace_front/emplace_at/
+    emplace são comparados com um modelo (vector) em sequências
+    aleatórias, conferindo os dois sentidos de percurso (cbegin e
+    crbegin). Quando a operação não cabe no destino, as listas não são
+    alteradas;
+  - códigos de status das variantes try_ (ListFull, ListEmpty,
+    ListOutOfRange, ListNotFound) e ListInvalidSide pelas operações com
+    'side': a lista fica inalterada em cada falha;
+  - move, e try_deslocate/deslocate na mesma lista e entre listas de
+    capacidades diferentes, também nas sequências aleatórias;
+  - uso em expressões constantes (constexpr), conferido com static_assert
+    (o alvo teste_estatica é compilado com C++14).
+*/
+
+#include "../ListaEstaticaDE.h"
+#include "Verificacao.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+typedef StaticDoublyLinkedList<string, 12> Lista;
+typedef StaticDoublyLinkedList<string, 7> Menor;
+typedef vector<string> Modelo;
+
+template <typename L>
+void verificar(const L& lista, const Modelo& modelo) {
+    VERIFICA(lista.length() == static_cast<int>(modelo.size()));
+    VERIFICA(Modelo(lista.cbegin(), lista.cend()) == modelo);
+    VERIFICA(Modelo(lista.crbegin(), lista.crend()) == Modelo(modelo.rbegin(), modelo.rend()));
+}
+
+void codigosDeStatus() {
+    typedef StaticDoublyLinkedList<string, 4> Pequena;
+    Pequena lista;
+    Modelo modelo;
+    string saida = "inalterada";
+
+    // Lista vazia
+    VERIFICA(lista.try_pop() == ListEmpty);
+    VERIFICA(lista.try_popFirst() == ListEmpty);
+    VERIFICA(lista.try_popAt(0, saida) == ListOutOfRange);
+    VERIFICA(lista.try_popByValue("a") == ListNotFound);
+    VERIFICA(lista.try_get(0, saida) == ListOutOfRange);
+    VERIFICA(lista.try_set(0, "a") == ListOutOfRange);
+    VERIFICA(lista.try_move(0, 0) == ListOutOfRange);
+    VERIFICA(lista.try_insertAt(1, "a") == ListOutOfRange);
+    VERIFICA(lista.try_insertRange(1, modelo.begin(), modelo.end()) == ListOutOfRange);
+    VERIFICA(saida == "inalterada");
+    VERIFICA_EXCECAO(lista.pop(), underflow_error);
+    VERIFICA_EXCECAO(lista.popFirst(), underflow_error);
+    VERIFICA_EXCECAO(lista.popAt(0), out_of_range);
+    VERIFICA_EXCECAO(lista.popByValue("a"), runtime_error);
+    VERIFICA_EXCECAO(lista.pop(0, 'd'), runtime_error);
+    verificar(lista, modelo);
+
+    VERIFICA(lista.try_push("b") == ListOk);
+    VERIFICA(lista.try_pushFirst("a") == ListOk);
+    VERIFICA(lista.try_insertAt(2, "c") == ListOk);
+    modelo = {"a", "b", "c"};
+    verificar(lista, modelo);
+
+    // Índices e valores inválidos com a lista não vazia
+    VERIFICA(lista.try_popAt(3, saida) == ListOutOfRange);
+    VERIFICA(lista.try_popAt(-1, saida) == ListOutOfRange);
+    VERIFICA(lista.try_get(3, saida) == ListOutOfRange);
+    VERIFICA(lista.try_set(-1, "z") == ListOutOfRange);
+    VERIFICA(lista.try_move(0, 3) == ListOutOfRange);
+    VERIFICA(lista.try_move(3, 0) == ListOutOfRange);
+    VERIFICA(lista.try_insertAt(4, "z") == ListOutOfRange);
+    VERIFICA(lista.try_popByValue("z") == ListNotFound);
+    VERIFICA(saida == "inalterada");
+    verificar(lista, modelo);
+
+    // Lado inválido (ListInvalidSide) e vizinho inexistente (ListNotFound)
+    VERIFICA_EXCECAO(lista.push("a", 'x'), invalid_argument);
+    VERIFICA_EXCECAO(lista.push(1, "z", 'x'), invalid_argument);
+    VERIFICA_EXCECAO(lista.popByValue("b", 'x'), invalid_argument);
+    VERIFICA_EXCECAO(lista.pop(1, 'x'), invalid_argument);
+    VERIFICA_EXCECAO(lista.popByValue("a", 'r'), runtime_error);
+    VERIFICA_EXCECAO(lista.popByValue("c", 'd'), runtime_error);
+    VERIFICA_EXCECAO(lista.pop(0, 'r'), runtime_error);
+    VERIFICA_EXCECAO(lista.pop(2, 'd'), runtime_error);
+    VERIFICA_EXCECAO(lista.push("z", 'd'), runtime_error);
+    verificar(lista, modelo);
+
+    // Lista cheia
+    VERIFICA(lista.try_push("d") == ListOk);
+    modelo.push_back("d");
+    VERIFICA(lista.full());
+    Modelo extra(1, "e");
+    VERIFICA(lista.try_push("e") == ListFull);
+    VERIFICA(lista.try_push(string("e")) == ListFull);
+    VERIFICA(lista.try_pushFirst("e") == ListFull);
+    VERIFICA(lista.try_insertAt(2, "e") == ListFull);
+    VERIFICA(lista.try_insertRange(2, extra.begin(), extra.end()) == ListFull);
+    VERIFICA(lista.try_pushRange(extra.begin(), extra.end()) == ListFull);
+    VERIFICA(lista.try_insertRange(4, extra.begin(), extra.begin()) == ListOk);
+    VERIFICA_EXCECAO(lista.push("e"), length_error);
+    VERIFICA_EXCECAO(lista.push("a", 'd'), length_error);
+    VERIFICA_EXCECAO(lista.push(0, "e", 'r'), length_error);
+    verificar(lista, modelo);
+
+    // Operações bem-sucedidas
+    VERIFICA(lista.try_get(1, saida) == ListOk && saida == "b");
+    VERIFICA(lista.try_set(1, "B") == ListOk);
+    VERIFICA(lista.try_popAt(1, saida) == ListOk && saida == "B");
+    VERIFICA(lista.try_popByValue("d") == ListOk);
+    VERIFICA(lista.try_pop() == ListOk);
+    VERIFICA(lista.try_popFirst() == ListOk);
+    VERIFICA(lista.empty());
+
+    VERIFICA(string(listStatusName(ListOk)) == "ok");
+    VERIFICA(string(listStatusName(ListFull)) == "cheia");
+    VERIFICA(string(listStatusName(ListEmpty)) == "vazia");
+    VERIFICA(string(listStatusName(ListOutOfRange)) == "fora dos limites");
+    VERIFICA(string(listStatusName(ListNotFound)) == "não encontrado");
+    VERIFICA(string(listStatusName(ListInvalidSide)) == "lado inválido");
+}
+
+void iteradores() {
+    Lista lista;
+    Lista::iterator padrao;
+    VERIFICA(padrao == lista.end());
+    VERIFICA_EXCECAO(lista.erase(lista.end()), runtime_error);
+    while (!lista.full())
+        lista.insert(lista.end(), "a");
+    VERIFICA_EXCECAO(lista.insert(lista.begin(), "b"), length_error);
+    VERIFICA_EXCECAO(lista.insert(lista.begin(), string("b")), length_error);
+    VERIFICA_EXCECAO(lista.emplace(lista.begin(), "b"), length_error);
+    VERIFICA_EXCECAO(lista.emplace_back("b"), length_error);
+    VERIFICA_EXCECAO(lista.erase(lista.end()), runtime_error);
+    verificar(lista, Modelo(Lista::capacity(), "a"));
+}
+
+template <typename L>
+void preencher(L& lista, Modelo& modelo, int n, mt19937& rng) {
+    for (int i = 0; i < n; i++) {
+        string valor(1, static_cast<char>('a' + rng() % 5));
+        lista.push(valor);
+        modelo.push_back(valor);
+    }
+}
+
+void sequenciaAleatoria(unsigned semente) {
+    mt19937 rng(semente);
+    for (int rodada = 0; rodada < 500; rodada++) {
+        Lista a;
+        Menor b;
+        Modelo ma, mb;
+        preencher(a, ma, static_cast<int>(rng() % 9), rng);
+        preencher(b, mb, static_cast<int>(rng() % 7), rng);
+        int na = a.length();
+        int nb = b.length();
+
+        switch (rng() % 8) {
+        case 0: {
+            a.sort();
+            b.sort();
+            sort(ma.begin(), ma.end());
+            sort(mb.begin(), mb.end());
+            Modelo esperado;
+            merge(ma.begin(), ma.end(), mb.begin(), mb.end(), back_inserter(esperado));
+            if (na + nb > Lista::capacity()) {
+                VERIFICA_EXCECAO(a.merge(b), length_error);
+            } else {
+                a.merge(b);
+                ma = esperado;
+                mb.clear();
+            }
+            a.merge(a);
+            break;
+        }
+        case 1: {
+            int primeiro = static_cast<int>(rng() % (nb + 1));
+            int ultimo = primeiro + static_cast<int>(rng() % (nb - primeiro + 1));
+            int pos = static_cast<int>(rng() % (na + 1));
+            if (ultimo - primeiro > Lista::capacity() - na) {
+                VERIFICA(try_splice(a, pos, b, primeiro, ultimo) == ListFull);
+                VERIFICA_EXCECAO(splice(a, pos, b, primeiro, ultimo), length_error);
+            } else {
+                splice(a, pos, b, primeiro, ultimo);
+                ma.insert(ma.begin() + pos, mb.begin() + primeiro, mb.begin() + ultimo);
+                mb.erase(mb.begin() + primeiro, mb.begin() + ultimo);
+            }
+            VERIFICA_EXCECAO(splice(a, 0, b, 0, b.length() + 1), out_of_range);
+            VERIFICA_EXCECAO(splice(b, b.length() + 1, a, 0, 0), out_of_range);
+            break;
+        }
+        case 2: {
+            int primeiro = static_cast<int>(rng() % (na + 1));
+            int ultimo = primeiro + static_cast<int>(rng() % (na - primeiro + 1));
+            int pos = static_cast<int>(rng() % (na + 1));
+            if (pos > primeiro && pos < ultimo) {
+                VERIFICA_EXCECAO(splice(a, pos, a, primeiro, ultimo), invalid_argument);
+                break;
+            }
+            splice(a, pos, a, primeiro, ultimo);
+            Modelo intervalo(ma.begin() + primeiro, ma.begin() + ultimo);
+            if (pos >= ultimo) {
+                ma.insert(ma.begin() + pos, intervalo.begin(), intervalo.end());
+                ma.erase(ma.begin() + primeiro, ma.begin() + ultimo);
+            } else {
+                ma.erase(ma.begin() + primeiro, ma.begin() + ultimo);
+                ma.insert(ma.begin() + pos, intervalo.begin(), intervalo.end());
+            }
+            break;
+        }
+        case 3: {
+            int pos = static_cast<int>(rng() % (na + 1));
+            VERIFICA_EXCECAO(a.insertRange(na + 1, mb.begin(), mb.end()), out_of_range);
+            if (nb > Lista::capacity() - na) {
+                VERIFICA_EXCECAO(a.insertRange(pos, mb.begin(), mb.end()), length_error);
+            } else {
+                VERIFICA(a.insertRange(pos, mb.begin(), mb.end()) == nb);
+                ma.insert(ma.begin() + pos, mb.begin(), mb.end());
+            }
+            break;
+        }
+        case 4: {
+            VERIFICA_EXCECAO(a.emplace_at(na + 1, "q"), out_of_range);
+            while (a.length() + 4 <= Lista::capacity() && rng() % 4 != 0) {
+                VERIFICA(a.emplace_back(3, 'x') == "xxx");
+                ma.push_back("xxx");
+                VERIFICA(a.emplace_front("yy") == "yy");
+                ma.insert(ma.begin(), "yy");
+                int pos = static_cast<int>(rng() % (ma.size() + 1));
+                VERIFICA(a.emplace_at(pos, 2, 'z') == "zz");
+                ma.insert(ma.begin() + pos, "zz");
+                // O argumento pode ser um elemento da própria lista
+                Lista::iterator segundo = a.begin();
+                ++segundo;
+                VERIFICA(*a.emplace(segundo, a[0]) == ma[0]);
+                ma.insert(ma.begin() + 1, ma[0]);
+            }
+            while (!a.full()) {
+                a.emplace_back();
+                ma.push_back("");
+            }
+            VERIFICA_EXCECAO(a.emplace_front("q"), length_error);
+            break;
+        }
+        case 5: {
+            VERIFICA(a.try_move(na, 0) == ListOutOfRange);
+            VERIFICA(a.try_move(0, na) == ListOutOfRange);
+            VERIFICA_EXCECAO(a.move(0, na), out_of_range);
+            if (na == 0)
+                break;
+            int indice = static_cast<int>(rng() % na);
+            int novo = static_cast<int>(rng() % na);
+            a.move(indice, novo);
+            string movido = ma[indice];
+            ma.erase(ma.begin() + indice);
+            // Se o elemento estava antes da nova posição, newIndex é ajustado
+            ma.insert(ma.begin() + (indice < novo ? novo - 1 : novo), movido);
+            break;
+        }
+        case 6: {
+            // Entre listas de capacidades diferentes, nos dois sentidos
+            VERIFICA(try_deslocate(a, b, na, 0) == ListOutOfRange);
+            VERIFICA(try_deslocate(b, a, 0, na + 1) == ListOutOfRange);
+            VERIFICA_EXCECAO(deslocate(a, b, -1, 0), out_of_range);
+            for (int vez = 0; vez < 4; vez++) {
+                bool paraMenor = rng() % 2 == 0;
+                if (paraMenor) {
+                    if (ma.empty())
+                        continue;
+                    int indice = static_cast<int>(rng() % ma.size());
+                    int novo = static_cast<int>(rng() % (mb.size() + 1));
+                    if (b.full()) {
+                        VERIFICA(try_deslocate(a, b, indice, novo) == ListFull);
+                        VERIFICA_EXCECAO(deslocate(a, b, indice, novo), length_error);
+                        continue;
+                    }
+                    if (rng() % 2)
+                        VERIFICA(try_deslocate(a, b, indice, novo) == ListOk);
+                    else
+                        deslocate(a, b, indice, novo);
+                    mb.insert(mb.begin() + novo, ma[indice]);
+                    ma.erase(ma.begin() + indice);
+                } else {
+                    if (mb.empty())
+                        continue;
+                    int indice = static_cast<int>(rng() % mb.size());
+                    int novo = static_cast<int>(rng() % (ma.size() + 1));
+                    if (a.full()) {
+                        VERIFICA(try_deslocate(b, a, indice, novo) == ListFull);
+                        continue;
+                    }
+                    deslocate(b, a, indice, novo);
+                    ma.insert(ma.begin() + novo, mb[indice]);
+                    mb.erase(mb.begin() + indice);
+                }
+                verificar(a, ma);
+                verificar(b, mb);
+            }
+            break;
+        }
+        case 7: {
+            // Na mesma lista (cheia ou não), o nó é religado
+            while (!b.full()) {
+                b.push("w");
+                mb.push_back("w");
+            }
+            int n = b.length();
+            VERIFICA(try_deslocate(b, b, 0, n) == ListOutOfRange);
+            int indice = static_cast<int>(rng() % n);
+            int novo = static_cast<int>(rng() % n);
+            VERIFICA(try_deslocate(b, b, indice, novo) == ListOk);
+            string movido = mb[indice];
+            mb.erase(mb.begin() + indice);
+            mb.insert(mb.begin() + novo, movido);
+            break;
+        }
+        }
+        verificar(a, ma);
+        verificar(b, mb);
+    }
+}
+
+// Expressões constantes: a lista é montada e alterada em tempo de compilação.
+constexpr StaticDoublyLinkedList<int, 8> montarTabela() {
+    StaticDoublyLinkedList<int, 8> tabela;
+    for (int i = 0; i < 8; i++)
+        tabela.pushFirst(i); // 7 6 5 4 3 2 1 0
+    tabela.move(0, 7);       // 6 5 4 3 2 1 7 0
+    tabela.popAt(1);         // 6 4 3 2 1 7 0
+    tabela.set(0, 60);       // 60 4 3 2 1 7 0
+    return tabela;
+}
+
+constexpr StaticDoublyLinkedList<int, 8> tabela = montarTabela();
+static_assert(tabela.length() == 7 && tabela[0] == 60 && tabela[1] == 4 && tabela[5] == 7 && tabela[6] == 0,
+              "Lista estática montada em tempo de compilação");
+
+constexpr int statusEmConstexpr() {
+    StaticDoublyLinkedList<int, 2> cheia;
+    StaticDoublyLinkedList<int, 3> maior;
+    int falhas = 0;
+    falhas += cheia.try_pop() == ListEmpty;
+    falhas += cheia.try_push(1) == ListOk;
+    falhas += cheia.try_push(2) == ListOk;
+    falhas += cheia.try_push(3) == ListFull;
+    falhas += cheia.try_popByValue(9) == ListNotFound;
+    falhas += cheia.try_move(0, 2) == ListOutOfRange;
+    // Entre capacidades diferentes: 1 vai para 'maior' e volta no fim
+    falhas += try_deslocate(cheia, maior, 0, 0) == ListOk;
+    falhas += try_deslocate(maior, cheia, 0, 1) == ListOk;
+    falhas += try_deslocate(maior, cheia, 0, 0) == ListOutOfRange;
+    falhas += cheia[0] == 2 && cheia[1] == 1 && maior.empty();
+    return falhas;
+}
+
+static_assert(statusEmConstexpr() == 10, "Variantes try_ em tempo de compilação");
+
+int main() {
+    codigosDeStatus();
+    iteradores();
+    for (unsigned semente = 1; semente <= 20; semente++)
+        sequenciaAleatoria(semente);
+    printf("StaticDoublyLinkedList: ok\n");
+    return 0;
+}
@@ -0,0 +1,273 @@
+/*
+Teste do índice de valores (HashValueIndex) da DoublyLinkedList:
+  - popAt move o valor para fora do nó antes de liberá-lo; o índice
+    deve esquecer o nó mesmo assim (popByValue e push(refValue, side)
+    seguintes não podem encontrá-lo);
+  - com valores repetidos, popByValue, popByValue(value, side) e
+    push(refValue, side) devem escolher a primeira ocorrência na ordem
+    da lista, exatamente como a NoValueIndex, depois de qualquer
+    sequência de pushFirst, insertAt, set, move, deslocate, splice,
+    sort, merge, insertRange e swap;
+  - um valor alterado por referência (operator[]) não é encontrado pelo
+    índice, e popByValue lança runtime_error em vez de acessar memória
+    inválida;
+  - inserções repetidas no mesmo ponto esgotam o espaço entre os rótulos
+    de ordem e forçam a reetiquetagem, sem mudar a ordem;
+  - a primeira ocorrência é encontrada sem percorrer a lista: remover
+    por valor milhares de duplicatas que estão depois de milhares de
+    outros valores é rápido.
+*/
+
+#include "../ListaGenericaDE.h"
+#include "Verificacao.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+typedef DoublyLinkedList<string> ListaLinear;
+typedef DoublyLinkedList<string, HeapNodeAllocator<string>, HashValueIndex<string> > ListaIndexada;
+typedef DoublyLinkedList<string, PoolNodeAllocator<string>, HashValueIndex<string> > ListaIndexadaPool;
+
+template <typename A, typename B>
+void verificarIguais(const A& a, const B& b) {
+    VERIFICA(a.length() == b.length());
+    typename B::const_iterator itB = b.begin();
+    for (typename A::const_iterator itA = a.begin(); itA != a.end(); ++itA, ++itB)
+        VERIFICA(*itA == *itB);
+    VERIFICA(itB == b.end());
+}
+
+void popAtSeguidoDePopByValue() {
+    ListaIndexada lista = {"alfa", "beta", "gama", "beta"};
+    VERIFICA(lista.popAt(1) == "beta");
+    VERIFICA(lista.popAt(0) == "alfa");
+    // O nó do "alfa" foi liberado: não pode continuar no índice
+    VERIFICA_EXCECAO(lista.popByValue("alfa"), runtime_error);
+    VERIFICA_EXCECAO(lista.push("alfa", 'd'), runtime_error);
+    // Nem sob o valor "movido" (string vazia)
+    VERIFICA_EXCECAO(lista.popByValue(""), runtime_error);
+    // O "beta" restante é o do final
+    lista.popByValue("beta");
+    VERIFICA(lista.length() == 1 && lista[0] == "gama");
+    lista.push("gama", 'r');
+    lista.popByValue("gama");
+    lista.popByValue("gama");
+    VERIFICA(lista.length() == 0);
+    VERIFICA_EXCECAO(lista.popByValue("gama"), runtime_error);
+}
+
+void primeiraOcorrenciaDirigida() {
+    ListaLinear linear;
+    ListaIndexada indexada;
+    const char* valores[] = {"x", "y", "x", "z", "x"};
+    for (int i = 0; i < 5; i++) {
+        linear.push(valores[i]);
+        indexada.push(valores[i]);
+    }
+    // O "x" inserido por último passa a ser o primeiro da lista
+    linear.move(4, 0);
+    indexada.move(4, 0);
+    linear.pushFirst("y");
+    indexada.pushFirst("y");
+    linear.popByValue("x", 'd');
+    indexada.popByValue("x", 'd');
+    verificarIguais(linear, indexada);
+    linear.push("y", 'd');
+    indexada.push("y", 'd');
+    linear.popByValue("x");
+    indexada.popByValue("x");
+    verificarIguais(linear, indexada);
+}
+
+void valorAlteradoPorReferencia() {
+    DoublyLinkedList<int, HeapNodeAllocator<int>, HashValueIndex<int> > lista;
+    lista.push(1);
+    lista.push(1);
+    lista.push(2);
+    lista[0] = 5;
+    lista[1] = 6;
+    VERIFICA_EXCECAO(lista.popByValue(1), runtime_error);
+    VERIFICA_EXCECAO(lista.push(1, 'd'), runtime_error);
+    lista.popByValue(2);
+    VERIFICA(lista.length() == 2 && lista[0] == 5 && lista[1] == 6);
+    // Só um dos nós alterado: o outro ainda é encontrado
+    lista.set(0, 1);
+    lista.set(1, 1);
+    lista[0] = 7;
+    lista.popByValue(1);
+    VERIFICA(lista.length() == 1 && lista[0] == 7);
+}
+
+void reetiquetagem() {
+    ListaLinear linear;
+    ListaIndexada indexada;
+    for (int i = 0; i < 8; i++) {
+        linear.push("b");
+        indexada.push("b");
+    }
+    // Sempre antes do mesmo nó: o espaço entre os rótulos se esgota
+    ListaLinear::iterator posLinear = linear.begin();
+    ListaIndexada::iterator posIndexada = indexada.begin();
+    ++++++posLinear;
+    ++++++posIndexada;
+    for (int i = 0; i < 3000; i++) {
+        string valor(1, static_cast<char>('a' + i % 3));
+        posLinear = linear.insert(posLinear, valor);
+        posIndexada = indexada.insert(posIndexada, valor);
+        if (i % 7 == 0) {
+            linear.popByValue(valor);
+            indexada.popByValue(valor);
+            posLinear = linear.begin();
+            posIndexada = indexada.begin();
+        }
+    }
+    verificarIguais(linear, indexada);
+    while (linear.length() > 0) {
+        string valor = linear[linear.length() / 2];
+        linear.popByValue(valor);
+        indexada.popByValue(valor);
+        verificarIguais(linear, indexada);
+    }
+}
+
+void duplicatasDistantes() {
+    const int N = 200000;
+    DoublyLinkedList<int, HeapNodeAllocator<int>, HashValueIndex<int> > lista;
+    for (int i = 0; i < N; i++)
+        lista.push(i);
+    for (int i = 0; i < N; i++)
+        lista.push(-1);
+    // Percorrer a partir do head custaria N nós por remoção
+    for (int i = 0; i < N; i++)
+        lista.popByValue(-1);
+    VERIFICA(lista.length() == N);
+    int esperado = 0;
+    for (DoublyLinkedList<int, HeapNodeAllocator<int>, HashValueIndex<int> >::iterator it = lista.begin();
+         it != lista.end(); ++it)
+        VERIFICA(*it == esperado++);
+}
+
+// Sequência aleatória comparando as duas políticas de índice.
+template <typename Indexada>
+void comparacaoAleatoria(unsigned semente) {
+    mt19937 rng(semente);
+    ListaLinear linear, linearOutra;
+    Indexada indexada, indexadaOutra;
+    for (int passo = 0; passo < 3000; passo++) {
+        int n = linear.length();
+        string valor(1, static_cast<char>('a' + rng() % 5));
+        int i = n ? static_cast<int>(rng() % n) : 0;
+        int j = n ? static_cast<int>(rng() % n) : 0;
+        char lado = (rng() & 1) ? 'd' : 'r';
+        bool erroLinear = false;
+        bool erroIndexada = false;
+        switch (rng() % 16) {
+        case 0:
+            linear.push(valor);
+            indexada.push(valor);
+            break;
+        case 1:
+            linear.pushFirst(valor);
+            indexada.pushFirst(valor);
+            break;
+        case 2: {
+            int k = static_cast<int>(rng() % (n + 1));
+            linear.insertAt(k, valor);
+            indexada.insertAt(k, valor);
+            break;
+        }
+        case 3:
+            if (n) {
+                linear.set(i, valor);
+                indexada.set(i, valor);
+            }
+            break;
+        case 4:
+            if (n) {
+                linear.move(i, j);
+                indexada.move(i, j);
+            }
+            break;
+        case 5:
+            if (n) {
+                VERIFICA(linear.popAt(i) == indexada.popAt(i));
+            }
+            break;
+        case 6:
+            try { linear.popByValue(valor); } catch (const runtime_error&) { erroLinear = true; }
+            try { indexada.popByValue(valor); } catch (const runtime_error&) { erroIndexada = true; }
+            break;
+        case 7:
+            try { linear.popByValue(valor, lado); } catch (const runtime_error&) { erroLinear = true; }
+            try { indexada.popByValue(valor, lado); } catch (const runtime_error&) { erroIndexada = true; }
+            break;
+        case 8:
+            try { linear.push(valor, lado); } catch (const runtime_error&) { erroLinear = true; }
+            try { indexada.push(valor, lado); } catch (const runtime_error&) { erroIndexada = true; }
+            break;
+        case 9:
+            if (n) {
+                int k = static_cast<int>(rng() % (linearOutra.length() + 1));
+                deslocate(linear, linearOutra, i, k);
+                deslocate(indexada, indexadaOutra, i, k);
+            }
+            break;
+        case 10: {
+            int m = linearOutra.length();
+            int a = static_cast<int>(rng() % (m + 1));
+            int b = a + static_cast<int>(rng() % (m - a + 1));
+            int k = static_cast<int>(rng() % (n + 1));
+            splice(linear, k, linearOutra, a, b);
+            splice(indexada, k, indexadaOutra, a, b);
+            break;
+        }
+        case 11:
+            if (n) {
+                deslocate(linear, linear, i, j);
+                deslocate(indexada, indexada, i, j);
+            }
+            break;
+        case 12:
+            linear.sort();
+            indexada.sort();
+            break;
+        case 13:
+            linear.sort();
+            linearOutra.sort();
+            indexada.sort();
+            indexadaOutra.sort();
+            linear.merge(linearOutra);
+            indexada.merge(indexadaOutra);
+            break;
+        case 14: {
+            string valores[3] = {valor, "a", valor};
+            int k = static_cast<int>(rng() % (n + 1));
+            linear.insertRange(k, valores, valores + 3);
+            indexada.insertRange(k, valores, valores + 3);
+            break;
+        }
+        case 15:
+            linear.swap(linearOutra);
+            indexada.swap(indexadaOutra);
+            break;
+        }
+        VERIFICA(erroLinear == erroIndexada);
+        verificarIguais(linear, indexada);
+        verificarIguais(linearOutra, indexadaOutra);
+    }
+}
+
+int main() {
+    popAtSeguidoDePopByValue();
+    primeiraOcorrenciaDirigida();
+    valorAlteradoPorReferencia();
+    reetiquetagem();
+    duplicatasDistantes();
+    for (unsigned semente = 1; semente <= 20; semente++) {
+        comparacaoAleatoria<ListaIndexada>(semente);
+        comparacaoAleatoria<ListaIndexadaPool>(semente);
+    }
+    printf("HashValueIndex: ok\n");
+    return 0;
+}
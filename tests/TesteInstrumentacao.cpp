@@ -0,0 +1,134 @@
+/*
+Teste da CountingInstrumentation: cada método da API registra a sua
+operação uma única vez (métodos que delegam a outros não contam em
+dobro), inclusive insert/emplace/erase por iterador, e as exceções e os
+nós criados/liberados ficam associados à chamada certa. O mesmo é
+conferido para insert/emplace/erase da lista compacta.
+Também confere que o destrutor não é registrado como uma chamada de
+clear() e que uma chamada feita durante o desempilhamento de outra
+exceção não é contada como encerrada por exceção (o alvo é compilado
+com C++11, sem uncaught_exceptions()).
+*/
+
+#include "../ListaGenericaDE.h"
+#include "../ListaCompactaDE.h"
+#include "Verificacao.h"
+
+typedef DoublyLinkedList<int, HeapNodeAllocator<int>, NoValueIndex<int>, CountingInstrumentation> Lista;
+
+typedef CompactDoublyLinkedList<int, CountingInstrumentation> Compacta;
+
+template <typename L>
+unsigned long long chamadas(const L& lista, ListOperation::Type op) {
+    return lista.instrumentation().snapshot()[op].calls;
+}
+
+// Política que apenas conta os escopos abertos, em contadores globais
+// que sobrevivem à lista.
+static int escoposAbertos[ListOperation::Count];
+
+struct ContaEscopos {
+    static const bool enabled = true;
+
+    class Scope {
+    public:
+        Scope(ContaEscopos&, ListOperation::Type op) { escoposAbertos[op]++; }
+    };
+
+    void traversed(int) {}
+    void allocated() {}
+    void freed(int) {}
+};
+
+void destrutorSemClear() {
+    {
+        DoublyLinkedList<int, HeapNodeAllocator<int>, NoValueIndex<int>, ContaEscopos> lista;
+        lista.push(1);
+        lista.push(2);
+    }
+    VERIFICA(escoposAbertos[ListOperation::Push] == 2);
+    VERIFICA(escoposAbertos[ListOperation::Clear] == 0);
+    {
+        DoublyLinkedList<int, HeapNodeAllocator<int>, NoValueIndex<int>, ContaEscopos> lista;
+        lista.push(1);
+        lista.clear();
+    }
+    VERIFICA(escoposAbertos[ListOperation::Clear] == 1);
+}
+
+// Usa a lista no destrutor, que roda enquanto outra exceção se propaga.
+struct UsaNoDestrutor {
+    Lista& lista;
+    explicit UsaNoDestrutor(Lista& l) : lista(l) {}
+    ~UsaNoDestrutor() { lista.push(99); }
+};
+
+void chamadaDuranteDesempilhamento() {
+    Lista lista;
+    try {
+        UsaNoDestrutor usa(lista);
+        throw runtime_error("Falha do usuário.");
+    } catch (const runtime_error&) {
+    }
+    InstrumentationSnapshot s = lista.instrumentation().snapshot();
+    VERIFICA(s[ListOperation::Push].calls == 1);
+    VERIFICA(s[ListOperation::Push].exceptions == 0);
+    VERIFICA(lista.length() == 1);
+}
+
+void listaCompacta() {
+    Compacta lista;
+    for (int i = 0; i < 4; i++)
+        lista.push(i);
+    Compacta::iterator it = lista.insert(lista.begin(), 10);
+    lista.emplace(lista.end(), 11);
+    VERIFICA(chamadas(lista, ListOperation::Insert) == 2);
+    VERIFICA(chamadas(lista, ListOperation::Push) == 4);
+
+    it = lista.erase(it);
+    VERIFICA(*it == 0);
+    VERIFICA_EXCECAO(lista.erase(lista.end()), runtime_error);
+    InstrumentationSnapshot s = lista.instrumentation().snapshot();
+    VERIFICA(s[ListOperation::Erase].calls == 2);
+    VERIFICA(s[ListOperation::Erase].exceptions == 1);
+    VERIFICA(s[ListOperation::Other].calls == 0);
+    VERIFICA(s.nodesAllocated == 6);
+    VERIFICA(s.nodesFreed == 1);
+}
+
+int main() {
+    Lista lista;
+    for (int i = 0; i < 4; i++)
+        lista.push(i);
+    VERIFICA(chamadas(lista, ListOperation::Push) == 4);
+
+    // insert delega a emplace: uma chamada de Insert cada
+    Lista::iterator it = lista.insert(lista.begin(), 10);
+    lista.emplace(lista.end(), 11);
+    VERIFICA(chamadas(lista, ListOperation::Insert) == 2);
+    VERIFICA(chamadas(lista, ListOperation::Push) == 4);
+
+    it = lista.erase(it);
+    VERIFICA(*it == 0);
+    VERIFICA_EXCECAO(lista.erase(lista.end()), runtime_error);
+    InstrumentationSnapshot s = lista.instrumentation().snapshot();
+    VERIFICA(s[ListOperation::Erase].calls == 2);
+    VERIFICA(s[ListOperation::Erase].exceptions == 1);
+    VERIFICA(s[ListOperation::Other].calls == 0);
+    VERIFICA(s.nodesAllocated == 6);
+    VERIFICA(s.nodesFreed == 1);
+
+    lista.insertAt(2, 12);
+    lista.popAt(0);
+    VERIFICA(chamadas(lista, ListOperation::InsertAt) == 1);
+    VERIFICA(chamadas(lista, ListOperation::PopAt) == 1);
+    VERIFICA(chamadas(lista, ListOperation::Get) == 0);
+
+    lista.instrumentation().reset();
+    VERIFICA(chamadas(lista, ListOperation::Insert) == 0);
+    listaCompacta();
+    destrutorSemClear();
+    chamadaDuranteDesempilhamento();
+    printf("CountingInstrumentation: ok\n");
+    return 0;
+}
@@ -0,0 +1,254 @@
+/*
+Teste da lista intrusiva (ListaIntrusivaDE.h):
+  - nenhuma operação aloca memória: operator new é substituído por uma
+    versão que conta as alocações, e cada chamada à lista é verificada
+    individualmente (o modelo do teste pode alocar à vontade);
+  - uma sequência aleatória de push, pushFirst, insertAt,
+    push(refObject, object, side), pop, popFirst, popAt, erase e
+    moveBefore (remoção e religação em O(1) pelo objeto), move e
+    deslocate (na mesma lista e entre listas) é comparada com um modelo
+    (vector), conferindo head/tail/next/prev pelos dois sentidos de
+    percurso e o dono de cada gancho;
+  - um objeto com dois ganchos pertence a duas listas ao mesmo tempo.
+*/
+
+#include "../ListaIntrusivaDE.h"
+#include "Verificacao.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+static long alocacoes = 0;
+
+void* operator new(size_t bytes) {
+    alocacoes++;
+    void* p = malloc(bytes ? bytes : 1);
+    if (!p)
+        throw bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+// Executa f e verifica que ela não alocou memória.
+template <typename F>
+void semAlocar(F f) {
+    long antes = alocacoes;
+    f();
+    VERIFICA(alocacoes == antes);
+}
+
+struct Item {
+    int id;
+    IntrusiveHook<Item> hook;
+    IntrusiveHook<Item> outroGancho;
+};
+
+typedef IntrusiveDoublyLinkedList<Item> Lista;
+typedef IntrusiveDoublyLinkedList<Item, &Item::outroGancho> OutraLista;
+typedef vector<int> Modelo;
+
+const int Itens = 48;
+
+void verificar(const Lista& lista, const Modelo& modelo, Item* itens) {
+    int n = static_cast<int>(modelo.size());
+    VERIFICA(lista.length() == n);
+    int i = 0;
+    for (Lista::const_iterator it = lista.begin(); it != lista.end(); ++it, ++i) {
+        VERIFICA(i < n);
+        VERIFICA(it->id == modelo[i]);
+    }
+    VERIFICA(i == n);
+    Lista::const_iterator it = lista.end();
+    for (i = n; i > 0; i--) {
+        --it;
+        VERIFICA(it->id == modelo[i - 1]);
+    }
+    VERIFICA(it == lista.begin());
+    for (int k = 0; k < n; k++) {
+        VERIFICA(lista.get(k).id == modelo[k]);
+        VERIFICA(lista.contains(itens[modelo[k]]));
+    }
+}
+
+// Índice de um objeto livre (fora das duas listas), ou -1.
+int livre(Item* itens, mt19937& rng) {
+    int inicio = static_cast<int>(rng() % Itens);
+    for (int k = 0; k < Itens; k++) {
+        int id = (inicio + k) % Itens;
+        if (!itens[id].hook.linked())
+            return id;
+    }
+    return -1;
+}
+
+void sequenciaAleatoria(unsigned semente) {
+    mt19937 rng(semente);
+    Item itens[Itens];
+    for (int id = 0; id < Itens; id++)
+        itens[id].id = id;
+    Lista listas[2];
+    Modelo modelos[2];
+
+    for (int passo = 0; passo < 5000; passo++) {
+        int a = static_cast<int>(rng() & 1);
+        Lista& lista = listas[a];
+        Modelo& modelo = modelos[a];
+        int n = static_cast<int>(modelo.size());
+        int i = n ? static_cast<int>(rng() % n) : 0;
+        int j = n ? static_cast<int>(rng() % n) : 0;
+        int id = livre(itens, rng);
+        char lado = (rng() & 1) ? 'd' : 'r';
+
+        switch (rng() % 12) {
+        case 0:
+            if (id >= 0) {
+                semAlocar([&] { lista.push(itens[id]); });
+                modelo.push_back(id);
+            }
+            break;
+        case 1:
+            if (id >= 0) {
+                semAlocar([&] { lista.pushFirst(itens[id]); });
+                modelo.insert(modelo.begin(), id);
+            }
+            break;
+        case 2:
+            if (id >= 0) {
+                int k = static_cast<int>(rng() % (n + 1));
+                semAlocar([&] { lista.insertAt(k, itens[id]); });
+                modelo.insert(modelo.begin() + k, id);
+            }
+            break;
+        case 3:
+            if (id >= 0 && n > 0) {
+                semAlocar([&] { lista.push(itens[modelo[i]], itens[id], lado); });
+                modelo.insert(modelo.begin() + i + (lado == 'd'), id);
+            }
+            break;
+        case 4:
+            if (n > 0) {
+                semAlocar([&] { VERIFICA(lista.pop().id == modelo.back()); });
+                modelo.pop_back();
+            } else {
+                VERIFICA_EXCECAO(lista.pop(), underflow_error);
+            }
+            break;
+        case 5:
+            if (n > 0) {
+                semAlocar([&] { VERIFICA(lista.popFirst().id == modelo.front()); });
+                modelo.erase(modelo.begin());
+            }
+            break;
+        case 6:
+            if (n > 0) {
+                semAlocar([&] { VERIFICA(lista.popAt(i).id == modelo[i]); });
+                modelo.erase(modelo.begin() + i);
+            }
+            break;
+        case 7:
+            // Remoção em O(1) pelo próprio objeto
+            if (n > 0) {
+                Item& objeto = itens[modelo[i]];
+                semAlocar([&] { lista.erase(objeto); });
+                VERIFICA(!objeto.hook.linked());
+                modelo.erase(modelo.begin() + i);
+                VERIFICA_EXCECAO(lista.erase(objeto), invalid_argument);
+            }
+            break;
+        case 8:
+            if (n > 0) {
+                semAlocar([&] { lista.move(i, j); });
+                int v = modelo[i];
+                modelo.erase(modelo.begin() + i);
+                modelo.insert(modelo.begin() + (i < j ? j - 1 : j), v);
+            }
+            break;
+        case 9:
+            // moveBefore em O(1): para antes de outro objeto ou para o final
+            if (n > 0) {
+                int v = modelo[i];
+                if (rng() & 1) {
+                    int r = modelo[j];
+                    semAlocar([&] { lista.moveBefore(itens[v], &itens[r]); });
+                    if (v != r) {
+                        modelo.erase(modelo.begin() + i);
+                        modelo.insert(find(modelo.begin(), modelo.end(), r), v);
+                    }
+                } else {
+                    semAlocar([&] { lista.moveBefore(itens[v], nullptr); });
+                    modelo.erase(modelo.begin() + i);
+                    modelo.push_back(v);
+                }
+            }
+            break;
+        case 10:
+            if (n > 0) {
+                if (rng() & 1) {
+                    semAlocar([&] { deslocate(lista, lista, i, j); });
+                    int v = modelo[i];
+                    modelo.erase(modelo.begin() + i);
+                    modelo.insert(modelo.begin() + j, v);
+                } else {
+                    Lista& destino = listas[1 - a];
+                    Modelo& modeloDestino = modelos[1 - a];
+                    int k = static_cast<int>(rng() % (modeloDestino.size() + 1));
+                    semAlocar([&] { deslocate(lista, destino, i, k); });
+                    modeloDestino.insert(modeloDestino.begin() + k, modelo[i]);
+                    modelo.erase(modelo.begin() + i);
+                }
+                VERIFICA_EXCECAO(deslocate(lista, lista, 0, static_cast<int>(modelo.size()) + 1), out_of_range);
+            }
+            break;
+        case 11:
+            if (rng() % 16 == 0) {
+                semAlocar([&] { lista.clear(); });
+                modelo.clear();
+            } else if (id >= 0 && n > 0) {
+                // Um objeto já ligado não pode entrar de novo
+                VERIFICA_EXCECAO(lista.push(itens[modelo[i]]), invalid_argument);
+            }
+            break;
+        }
+        verificar(listas[0], modelos[0], itens);
+        verificar(listas[1], modelos[1], itens);
+    }
+    for (int l = 0; l < 2; l++)
+        listas[l].clear();
+}
+
+void doisGanchos() {
+    Item itens[4];
+    Lista lista;
+    OutraLista outra;
+    semAlocar([&] {
+        for (int id = 0; id < 4; id++) {
+            itens[id].id = id;
+            lista.push(itens[id]);
+            outra.pushFirst(itens[id]);
+        }
+    });
+    VERIFICA(lista[0].id == 0 && outra[0].id == 3);
+    semAlocar([&] { outra.erase(itens[2]); });
+    VERIFICA(lista.length() == 4 && outra.length() == 3);
+    VERIFICA(lista.contains(itens[2]) && !outra.contains(itens[2]));
+    lista.clear();
+    outra.clear();
+}
+
+int main() {
+    doisGanchos();
+    for (unsigned semente = 1; semente <= 20; semente++)
+        sequenciaAleatoria(semente);
+    printf("IntrusiveDoublyLinkedList: ok\n");
+    return 0;
+}
@@ -0,0 +1,456 @@
+/*
+Teste das invariantes estruturais da DoublyLinkedList: depois de cada
+método que altera a lista, confere head, tail, os ponteiros next/prev e
+o tamanho contra um modelo (vector):
+  - o percurso a partir do head (next) reproduz o modelo e termina após
+    length() nós;
+  - o percurso a partir do tail (prev) reproduz o modelo invertido;
+  - get(i) encontra o elemento certo em todas as posições (caminhando
+    da extremidade mais próxima ou do cursor).
+Primeiro cada método é exercitado em casos dirigidos (extremidades,
+exceções que não podem alterar a lista) e depois em uma sequência
+aleatória de operações sobre duas listas (para deslocate e splice).
+Roda com os três alocadores (heap, pool e arena), com o índice de
+valores por hash e com um dado do tipo string (Texto), para exercitar
+construção, movimento e destruição de valores não triviais.
+*/
+
+#include "../ListaGenericaDE.h"
+#include "Verificacao.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+typedef vector<int> Modelo;
+
+// Dado do tipo string, convertido de e para int para usar o mesmo
+// modelo. O valor é lido de volta do próprio texto, que é longo o
+// bastante para ficar no heap: um texto perdido ou corrompido é
+// detectado na comparação com o modelo.
+struct Texto {
+    string texto;
+
+    Texto(int v = 0) : texto(to_string(v) + string(32, '#')) {}
+    operator int() const { return atoi(texto.c_str()); }
+};
+
+template <typename Lista>
+void verificarInvariantes(const Lista& lista, const Modelo& modelo) {
+    int n = static_cast<int>(modelo.size());
+    VERIFICA(lista.length() == n);
+    VERIFICA((lista.begin() == lista.end()) == (n == 0));
+
+    // head -> tail pelos ponteiros next
+    int i = 0;
+    for (typename Lista::const_iterator it = lista.begin(); it != lista.end(); ++it, ++i) {
+        VERIFICA(i < n);
+        VERIFICA(*it == modelo[i]);
+    }
+    VERIFICA(i == n);
+
+    // tail -> head pelos ponteiros prev
+    i = n;
+    for (typename Lista::const_reverse_iterator it = lista.rbegin(); it != lista.rend(); ++it) {
+        VERIFICA(i > 0);
+        VERIFICA(*it == modelo[--i]);
+    }
+    VERIFICA(i == 0);
+
+    for (int k = 0; k < n; k++)
+        VERIFICA(lista.get(k) == modelo[k]);
+}
+
+// Posição da primeira ocorrência de value no modelo (-1 se não houver).
+int primeira(const Modelo& modelo, int value) {
+    Modelo::const_iterator it = find(modelo.begin(), modelo.end(), value);
+    return (it == modelo.end()) ? -1 : static_cast<int>(it - modelo.begin());
+}
+
+// move(i, j) no modelo: como na lista, j é decrementado quando i < j.
+void moverModelo(Modelo& modelo, int i, int j) {
+    int v = modelo[i];
+    modelo.erase(modelo.begin() + i);
+    modelo.insert(modelo.begin() + (i < j ? j - 1 : j), v);
+}
+
+template <typename Lista>
+void casosDirigidos() {
+    Lista lista;
+    Modelo modelo;
+    verificarInvariantes(lista, modelo);
+
+    // Extremidades vazias
+    VERIFICA_EXCECAO(lista.pop(), underflow_error);
+    VERIFICA_EXCECAO(lista.popFirst(), underflow_error);
+    VERIFICA_EXCECAO(lista.popAt(0), out_of_range);
+    verificarInvariantes(lista, modelo);
+
+    // push / pushFirst / pop / popFirst com um único elemento
+    lista.push(1);
+    modelo.push_back(1);
+    verificarInvariantes(lista, modelo);
+    lista.pop();
+    modelo.pop_back();
+    verificarInvariantes(lista, modelo);
+    lista.pushFirst(2);
+    modelo.insert(modelo.begin(), 2);
+    verificarInvariantes(lista, modelo);
+    lista.popFirst();
+    modelo.erase(modelo.begin());
+    verificarInvariantes(lista, modelo);
+
+    for (int v = 0; v < 6; v++) {
+        lista.push(v);
+        modelo.push_back(v);
+    }
+    verificarInvariantes(lista, modelo);
+
+    // push(index, value, side) nas extremidades
+    lista.push(0, 10, 'r');
+    modelo.insert(modelo.begin(), 10);
+    verificarInvariantes(lista, modelo);
+    lista.push(lista.length() - 1, 11, 'd');
+    modelo.push_back(11);
+    verificarInvariantes(lista, modelo);
+    lista.push(3, 12, 'd');
+    modelo.insert(modelo.begin() + 4, 12);
+    verificarInvariantes(lista, modelo);
+    VERIFICA_EXCECAO(lista.push(lista.length(), 13, 'd'), out_of_range);
+    VERIFICA_EXCECAO(lista.push(0, 13, 'x'), invalid_argument);
+    verificarInvariantes(lista, modelo);
+
+    // push(refValue, side)
+    lista.push(11, 'd');
+    modelo.push_back(11);
+    lista.push(10, 'r');
+    modelo.insert(modelo.begin(), 10);
+    verificarInvariantes(lista, modelo);
+    VERIFICA_EXCECAO(lista.push(99, 'd'), runtime_error);
+
+    // Remoções ao lado: head e tail (removeNode nas extremidades)
+    lista.pop(1, 'r');
+    modelo.erase(modelo.begin());
+    verificarInvariantes(lista, modelo);
+    lista.pop(lista.length() - 2, 'd');
+    modelo.pop_back();
+    verificarInvariantes(lista, modelo);
+    VERIFICA_EXCECAO(lista.pop(0, 'r'), runtime_error);
+    VERIFICA_EXCECAO(lista.pop(lista.length() - 1, 'd'), runtime_error);
+    lista.popByValue(10, 'd');
+    modelo.erase(modelo.begin() + 1);
+    verificarInvariantes(lista, modelo);
+
+    // move para as extremidades e a partir delas
+    lista.move(0, lista.length() - 1);
+    moverModelo(modelo, 0, static_cast<int>(modelo.size()) - 1);
+    verificarInvariantes(lista, modelo);
+    lista.move(lista.length() - 1, 0);
+    rotate(modelo.rbegin(), modelo.rbegin() + 1, modelo.rend());
+    verificarInvariantes(lista, modelo);
+    VERIFICA_EXCECAO(lista.move(0, lista.length()), out_of_range);
+    verificarInvariantes(lista, modelo);
+
+    // deslocate dentro da lista e para outra lista, incluindo extremidades
+    Lista outra;
+    Modelo modeloOutra;
+    deslocate(lista, outra, 0, 0);
+    modeloOutra.push_back(modelo.front());
+    modelo.erase(modelo.begin());
+    deslocate(lista, outra, lista.length() - 1, 1);
+    modeloOutra.push_back(modelo.back());
+    modelo.pop_back();
+    verificarInvariantes(lista, modelo);
+    verificarInvariantes(outra, modeloOutra);
+    deslocate(lista, lista, 0, lista.length() - 1);
+    rotate(modelo.begin(), modelo.begin() + 1, modelo.end());
+    verificarInvariantes(lista, modelo);
+    VERIFICA_EXCECAO(deslocate(lista, outra, 0, 5), out_of_range);
+    VERIFICA_EXCECAO(deslocate(lista, lista, 0, lista.length()), out_of_range);
+    verificarInvariantes(lista, modelo);
+    verificarInvariantes(outra, modeloOutra);
+
+    // merge com a própria lista não altera nada
+    lista.merge(lista);
+    verificarInvariantes(lista, modelo);
+
+    // Esvaziar pela cauda e pela cabeça
+    while (lista.length() > 0) {
+        if (lista.length() % 2) {
+            lista.pop();
+            modelo.pop_back();
+        } else {
+            lista.popFirst();
+            modelo.erase(modelo.begin());
+        }
+        verificarInvariantes(lista, modelo);
+    }
+    lista.push(7);
+    modelo.push_back(7);
+    verificarInvariantes(lista, modelo);
+    outra.clear();
+    modeloOutra.clear();
+    verificarInvariantes(outra, modeloOutra);
+}
+
+// Aplica à lista (e ao modelo) a operação 'op' com parâmetros aleatórios.
+template <typename Lista>
+void operacaoAleatoria(int op, Lista& lista, Modelo& modelo, Lista& outra, Modelo& modeloOutra, mt19937& rng) {
+    int n = static_cast<int>(modelo.size());
+    int valor = static_cast<int>(rng() % 10);
+    int i = n ? static_cast<int>(rng() % n) : 0;
+    int j = n ? static_cast<int>(rng() % n) : 0;
+    char lado = (rng() & 1) ? 'd' : 'r';
+    int ref = primeira(modelo, valor);
+
+    switch (op) {
+    case 0:
+        lista.push(valor);
+        modelo.push_back(valor);
+        break;
+    case 1:
+        lista.pushFirst(valor);
+        modelo.insert(modelo.begin(), valor);
+        break;
+    case 2: {
+        int k = static_cast<int>(rng() % (n + 1));
+        lista.insertAt(k, valor);
+        modelo.insert(modelo.begin() + k, valor);
+        break;
+    }
+    case 3:
+        if (ref < 0) {
+            VERIFICA_EXCECAO(lista.push(valor, lado), runtime_error);
+        } else {
+            lista.push(valor, lado);
+            modelo.insert(modelo.begin() + ref + (lado == 'd'), valor);
+        }
+        break;
+    case 4:
+        if (n == 0) {
+            VERIFICA_EXCECAO(lista.push(0, valor, lado), out_of_range);
+        } else {
+            lista.push(i, valor, lado);
+            modelo.insert(modelo.begin() + i + (lado == 'd'), valor);
+        }
+        break;
+    case 5:
+        if (n == 0) {
+            VERIFICA_EXCECAO(lista.pop(), underflow_error);
+        } else {
+            lista.pop();
+            modelo.pop_back();
+        }
+        break;
+    case 6:
+        if (n == 0) {
+            VERIFICA_EXCECAO(lista.popFirst(), underflow_error);
+        } else {
+            lista.popFirst();
+            modelo.erase(modelo.begin());
+        }
+        break;
+    case 7:
+        if (ref < 0) {
+            VERIFICA_EXCECAO(lista.popByValue(valor), runtime_error);
+        } else {
+            lista.popByValue(valor);
+            modelo.erase(modelo.begin() + ref);
+        }
+        break;
+    case 8: {
+        int alvo = (ref < 0) ? -1 : ref + (lado == 'd' ? 1 : -1);
+        if (alvo < 0 || alvo >= n) {
+            VERIFICA_EXCECAO(lista.popByValue(valor, lado), runtime_error);
+        } else {
+            lista.popByValue(valor, lado);
+            modelo.erase(modelo.begin() + alvo);
+        }
+        break;
+    }
+    case 9: {
+        int alvo = i + (lado == 'd' ? 1 : -1);
+        if (n < 2 || alvo < 0 || alvo >= n) {
+            VERIFICA_EXCECAO(lista.pop(i, lado), runtime_error);
+        } else {
+            lista.pop(i, lado);
+            modelo.erase(modelo.begin() + alvo);
+        }
+        break;
+    }
+    case 10:
+        if (n > 0) {
+            VERIFICA(lista.popAt(i) == modelo[i]);
+            modelo.erase(modelo.begin() + i);
+        }
+        break;
+    case 11:
+        if (n > 0) {
+            lista.move(i, j);
+            moverModelo(modelo, i, j);
+        }
+        break;
+    case 12:
+        if (n > 0) {
+            lista.set(i, valor);
+            modelo[i] = valor;
+        }
+        break;
+    case 13: {
+        // deslocate para a outra lista (ou dentro da mesma)
+        if (n == 0)
+            break;
+        if (rng() & 1) {
+            deslocate(lista, lista, i, j);
+            int v = modelo[i];
+            modelo.erase(modelo.begin() + i);
+            modelo.insert(modelo.begin() + j, v);
+        } else {
+            int k = static_cast<int>(rng() % (modeloOutra.size() + 1));
+            deslocate(lista, outra, i, k);
+            modeloOutra.insert(modeloOutra.begin() + k, modelo[i]);
+            modelo.erase(modelo.begin() + i);
+        }
+        break;
+    }
+    case 14: {
+        // splice de um intervalo da outra lista para esta
+        int m = static_cast<int>(modeloOutra.size());
+        int a = static_cast<int>(rng() % (m + 1));
+        int b = a + static_cast<int>(rng() % (m - a + 1));
+        int k = static_cast<int>(rng() % (n + 1));
+        splice(lista, k, outra, a, b);
+        modelo.insert(modelo.begin() + k, modeloOutra.begin() + a, modeloOutra.begin() + b);
+        modeloOutra.erase(modeloOutra.begin() + a, modeloOutra.begin() + b);
+        break;
+    }
+    case 15: {
+        int valores[3] = {valor, valor + 1, valor + 2};
+        int k = static_cast<int>(rng() % (n + 1));
+        if (rng() & 1) {
+            lista.pushRange(valores, valores + 3);
+            modelo.insert(modelo.end(), valores, valores + 3);
+        } else {
+            lista.insertRange(k, valores, valores + 3);
+            modelo.insert(modelo.begin() + k, valores, valores + 3);
+        }
+        break;
+    }
+    case 16:
+        if (rng() & 1) {
+            VERIFICA(lista.removeAll(valor) == static_cast<int>(count(modelo.begin(), modelo.end(), valor)));
+            modelo.erase(std::remove(modelo.begin(), modelo.end(), valor), modelo.end());
+        } else {
+            int limite = valor;
+            lista.removeIf([limite](int v) { return v > limite + 5; });
+            modelo.erase(remove_if(modelo.begin(), modelo.end(), [limite](int v) { return v > limite + 5; }),
+                         modelo.end());
+        }
+        break;
+    case 17: {
+        // Iteradores: insert, emplace e erase
+        typename Lista::iterator it = lista.begin();
+        std::advance(it, i);
+        if (n > 0 && (rng() & 1)) {
+            lista.erase(it);
+            modelo.erase(modelo.begin() + i);
+        } else if (rng() & 1) {
+            lista.insert(it, valor);
+            modelo.insert(modelo.begin() + i, valor);
+        } else {
+            lista.emplace(lista.end(), valor);
+            modelo.push_back(valor);
+        }
+        break;
+    }
+    case 18:
+        if (rng() & 1) {
+            lista.emplace_front(valor);
+            modelo.insert(modelo.begin(), valor);
+        } else {
+            int k = static_cast<int>(rng() % (n + 1));
+            lista.emplace_at(k, valor);
+            modelo.insert(modelo.begin() + k, valor);
+        }
+        break;
+    case 19:
+        if (rng() % 4 == 0) {
+            lista.sort();
+            stable_sort(modelo.begin(), modelo.end());
+        } else if (rng() & 1) {
+            lista.unique();
+            modelo.erase(std::unique(modelo.begin(), modelo.end()), modelo.end());
+        } else {
+            lista.sort();
+            stable_sort(modelo.begin(), modelo.end());
+            lista.insertSorted(valor);
+            modelo.insert(upper_bound(modelo.begin(), modelo.end(), valor), valor);
+        }
+        break;
+    case 20:
+        // merge com a outra lista (ambas ordenadas antes)
+        lista.sort();
+        outra.sort();
+        stable_sort(modelo.begin(), modelo.end());
+        stable_sort(modeloOutra.begin(), modeloOutra.end());
+        lista.merge(outra);
+        {
+            Modelo resultado;
+            std::merge(modelo.begin(), modelo.end(), modeloOutra.begin(), modeloOutra.end(), back_inserter(resultado));
+            modelo.swap(resultado);
+            modeloOutra.clear();
+        }
+        break;
+    case 21:
+        if (rng() % 8 == 0) {
+            lista.clear();
+            modelo.clear();
+        } else if (rng() & 1) {
+            lista.swap(outra);
+            modelo.swap(modeloOutra);
+        } else {
+            Lista copia(lista);
+            lista = std::move(copia);
+        }
+        break;
+    }
+}
+
+template <typename Lista>
+void sequenciaAleatoria(unsigned semente) {
+    mt19937 rng(semente);
+    Lista lista;
+    Lista outra;
+    Modelo modelo;
+    Modelo modeloOutra;
+    for (int passo = 0; passo < 4000; passo++) {
+        // Operações que só aumentam a lista ficam menos frequentes quando ela cresce
+        int op = static_cast<int>(rng() % 22);
+        if (modelo.size() > 60 && (op <= 4 || op == 14 || op == 15 || op == 18))
+            op = 5 + static_cast<int>(rng() % 5);
+        operacaoAleatoria(op, lista, modelo, outra, modeloOutra, rng);
+        verificarInvariantes(lista, modelo);
+        verificarInvariantes(outra, modeloOutra);
+    }
+}
+
+template <typename Lista>
+void testar(const char* nome) {
+    casosDirigidos<Lista>();
+    for (unsigned semente = 1; semente <= 20; semente++)
+        sequenciaAleatoria<Lista>(semente);
+    printf("%s: ok\n", nome);
+}
+
+int main() {
+    testar<DoublyLinkedList<int> >("DoublyLinkedList<int>");
+    testar<DoublyLinkedList<int, PoolNodeAllocator<int> > >("DoublyLinkedList<int, PoolNodeAllocator>");
+    testar<DoublyLinkedList<int, ArenaNodeAllocator<int> > >("DoublyLinkedList<int, ArenaNodeAllocator>");
+    testar<DoublyLinkedList<Texto> >("DoublyLinkedList<Texto>");
+    testar<DoublyLinkedList<Texto, PoolNodeAllocator<Texto> > >("DoublyLinkedList<Texto, PoolNodeAllocator>");
+    testar<DoublyLinkedList<Texto, ArenaNodeAllocator<Texto> > >("DoublyLinkedList<Texto, ArenaNodeAllocator>");
+    testar<DoublyLinkedList<int, HeapNodeAllocator<int>, HashValueIndex<int> > >("DoublyLinkedList<int, HashValueIndex>");
+    return 0;
+}
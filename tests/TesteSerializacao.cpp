@@ -0,0 +1,96 @@
+/*
+Teste da serialização binária (ListaSerializacaoDE.h):
+  - save/load por stream e por arquivo (mmap) preservam a lista, com int
+    e com string (vazia, curta e maior que um bloco de leitura);
+  - um tamanho de string corrompido (maior que o resto do arquivo) ou um
+    arquivo truncado lançam runtime_error sem alterar a lista de destino.
+    Pelo stream, o tamanho corrompido não pode provocar uma alocação do
+    tamanho declarado (bad_alloc).
+*/
+
+#include "../ListaSerializacaoDE.h"
+#include "Verificacao.h"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+template <typename T>
+vector<T> valores(const DoublyLinkedList<T>& lista) {
+    return vector<T>(lista.begin(), lista.end());
+}
+
+static string gravar(const DoublyLinkedList<string>& lista) {
+    stringstream out;
+    save(lista, out);
+    return out.str();
+}
+
+static void idaEVolta() {
+    DoublyLinkedList<int> inteiros;
+    for (int i = 0; i < 10000; i++)
+        inteiros.push(i * 7 - 300);
+    DoublyLinkedList<string> textos;
+    textos.push("");
+    textos.push("curta");
+    textos.push(string(200000, 'a'));
+    textos.push("fim");
+
+    stringstream s1;
+    save(inteiros, s1);
+    DoublyLinkedList<int> inteirosLidos;
+    load(inteirosLidos, s1);
+    VERIFICA(valores(inteirosLidos) == valores(inteiros));
+
+    stringstream s2(gravar(textos));
+    DoublyLinkedList<string> textosLidos;
+    load(textosLidos, s2);
+    VERIFICA(valores(textosLidos) == valores(textos));
+
+    const string caminho = "teste_serializacao.bin";
+    save(textos, caminho);
+    DoublyLinkedList<string> doArquivo;
+    load(doArquivo, caminho);
+    VERIFICA(valores(doArquivo) == valores(textos));
+    remove(caminho.c_str());
+}
+
+static void dadosInvalidos() {
+    DoublyLinkedList<string> textos;
+    textos.push("abc");
+    textos.push("def");
+    string dados = gravar(textos);
+
+    DoublyLinkedList<string> destino;
+    destino.push("inalterada");
+
+    // Tamanho do primeiro elemento (logo após o cabeçalho) corrompido
+    string corrompido = dados;
+    uint32_t enorme = 0xFFFFFFF0u;
+    memcpy(&corrompido[BinaryHeader::Size], &enorme, sizeof(enorme));
+    stringstream s1(corrompido);
+    VERIFICA_EXCECAO(load(destino, s1), runtime_error);
+    VERIFICA(destino.length() == 1 && destino.get(0) == "inalterada");
+
+    const string caminho = "teste_serializacao_invalido.bin";
+    {
+        ofstream arquivo(caminho.c_str(), ios::binary);
+        arquivo.write(corrompido.data(), static_cast<streamsize>(corrompido.size()));
+    }
+    VERIFICA_EXCECAO(load(destino, caminho), runtime_error);
+    VERIFICA(destino.length() == 1 && destino.get(0) == "inalterada");
+    remove(caminho.c_str());
+
+    // Arquivo truncado no meio do último elemento
+    stringstream s2(dados.substr(0, dados.size() - 1));
+    VERIFICA_EXCECAO(load(destino, s2), runtime_error);
+    VERIFICA(destino.length() == 1 && destino.get(0) == "inalterada");
+}
+
+int main() {
+    idaEVolta();
+    dadosInvalidos();
+    printf("Serialização: ok\n");
+    return 0;
+}
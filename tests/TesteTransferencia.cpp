@@ -0,0 +1,164 @@
+/*
+Teste das transferências entre listas cujos alocadores não permitem
+trocar nós (PoolNodeAllocator e ArenaNodeAllocator): splice, deslocate
+e merge movem cada valor para um nó da lista de destino. Com um tipo
+cujo construtor de movimento/cópia lança exceção na k-ésima chamada,
+para todo k:
+  - se a operação lançar, as duas listas ficam exatamente como antes
+    (nenhum elemento perdido, nenhum nó liberado duas vezes, slabs da
+    arena intactos);
+  - se não lançar, o resultado é o do modelo (vector).
+São usados um tipo copiável (os valores são copiados, pois o movimento
+pode lançar) e um tipo só movível (os valores já movidos voltam aos nós
+originais).
+*/
+
+#include "../ListaGenericaDE.h"
+#include "Verificacao.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+// Construções restantes até a próxima exceção (-1: nunca lança).
+static int construcoesAteFalha = -1;
+
+static void talvezFalhar() {
+    if (construcoesAteFalha == 0) {
+        construcoesAteFalha = -1;
+        throw runtime_error("Falha simulada na construção.");
+    }
+    if (construcoesAteFalha > 0)
+        construcoesAteFalha--;
+}
+
+struct Copiavel {
+    int valor;
+
+    Copiavel(int v) : valor(v) {}
+    Copiavel(const Copiavel& other) : valor(other.valor) { talvezFalhar(); }
+    Copiavel(Copiavel&& other) : valor(other.valor) { talvezFalhar(); }
+    Copiavel& operator=(const Copiavel& other) = default;
+};
+
+struct SoMovivel {
+    int valor;
+
+    SoMovivel(int v) : valor(v) {}
+    SoMovivel(const SoMovivel&) = delete;
+    SoMovivel(SoMovivel&& other) : valor(other.valor) {
+        talvezFalhar();
+        other.valor = -1;
+    }
+    SoMovivel& operator=(SoMovivel&& other) noexcept {
+        valor = other.valor;
+        other.valor = -1;
+        return *this;
+    }
+};
+
+bool operator<(const Copiavel& a, const Copiavel& b) { return a.valor < b.valor; }
+bool operator<(const SoMovivel& a, const SoMovivel& b) { return a.valor < b.valor; }
+
+typedef vector<int> Modelo;
+
+template <typename Lista>
+void preencher(Lista& lista, Modelo& modelo, int inicio, int n, int passo) {
+    for (int i = 0; i < n; i++) {
+        lista.emplace_back(inicio + i * passo);
+        modelo.push_back(inicio + i * passo);
+    }
+}
+
+template <typename Lista>
+void verificar(const Lista& lista, const Modelo& modelo) {
+    int n = static_cast<int>(modelo.size());
+    VERIFICA(lista.length() == n);
+    int i = 0;
+    for (typename Lista::const_iterator it = lista.begin(); it != lista.end(); ++it, ++i) {
+        VERIFICA(i < n);
+        VERIFICA(it->valor == modelo[i]);
+    }
+    VERIFICA(i == n);
+    for (typename Lista::const_reverse_iterator it = lista.rbegin(); it != lista.rend(); ++it)
+        VERIFICA(it->valor == modelo[--i]);
+    VERIFICA(i == 0);
+}
+
+// Executa a operação com falha na k-ésima construção, para k = 0, 1, ...,
+// até que ela termine sem exceção.
+template <typename Lista, typename Operacao>
+void comFalhas(Operacao operacao) {
+    for (int k = 0;; k++) {
+        Lista origem;
+        Lista destino;
+        Modelo modeloOrigem;
+        Modelo modeloDestino;
+        // Vários slabs na arena e no pool
+        preencher(origem, modeloOrigem, 0, 300, 2);
+        preencher(destino, modeloDestino, 1, 300, 2);
+        construcoesAteFalha = k;
+        bool lancou = false;
+        try {
+            operacao(origem, destino, modeloOrigem, modeloDestino);
+        } catch (const runtime_error&) {
+            lancou = true;
+        }
+        construcoesAteFalha = -1;
+        if (lancou) {
+            Modelo intactoOrigem;
+            Modelo intactoDestino;
+            for (int i = 0; i < 300; i++) {
+                intactoOrigem.push_back(2 * i);
+                intactoDestino.push_back(2 * i + 1);
+            }
+            verificar(origem, intactoOrigem);
+            verificar(destino, intactoDestino);
+        } else {
+            verificar(origem, modeloOrigem);
+            verificar(destino, modeloDestino);
+        }
+        // As listas continuam utilizáveis depois da falha
+        origem.emplace_back(-5);
+        destino.popFirst();
+        if (!lancou)
+            return;
+    }
+}
+
+template <typename Lista>
+void testar(const char* nome) {
+    // splice de um trecho do meio para o meio de outra lista
+    comFalhas<Lista>([](Lista& origem, Lista& destino, Modelo& mo, Modelo& md) {
+        splice(destino, 10, origem, 100, 140);
+        md.insert(md.begin() + 10, mo.begin() + 100, mo.begin() + 140);
+        mo.erase(mo.begin() + 100, mo.begin() + 140);
+    });
+    // splice da lista inteira para o final
+    comFalhas<Lista>([](Lista& origem, Lista& destino, Modelo& mo, Modelo& md) {
+        splice(destino, destino.length(), origem, 0, origem.length());
+        md.insert(md.end(), mo.begin(), mo.end());
+        mo.clear();
+    });
+    comFalhas<Lista>([](Lista& origem, Lista& destino, Modelo& mo, Modelo& md) {
+        deslocate(origem, destino, 7, 3);
+        md.insert(md.begin() + 3, mo[7]);
+        mo.erase(mo.begin() + 7);
+    });
+    comFalhas<Lista>([](Lista& origem, Lista& destino, Modelo& mo, Modelo& md) {
+        destino.merge(origem);
+        Modelo resultado;
+        merge(md.begin(), md.end(), mo.begin(), mo.end(), back_inserter(resultado));
+        md = resultado;
+        mo.clear();
+    });
+    printf("%s: ok\n", nome);
+}
+
+int main() {
+    testar<DoublyLinkedList<Copiavel, PoolNodeAllocator<Copiavel> > >("PoolNodeAllocator<Copiavel>");
+    testar<DoublyLinkedList<Copiavel, ArenaNodeAllocator<Copiavel> > >("ArenaNodeAllocator<Copiavel>");
+    testar<DoublyLinkedList<SoMovivel, PoolNodeAllocator<SoMovivel> > >("PoolNodeAllocator<SoMovivel>");
+    testar<DoublyLinkedList<SoMovivel, ArenaNodeAllocator<SoMovivel> > >("ArenaNodeAllocator<SoMovivel>");
+    return 0;
+}
@@ -0,0 +1,266 @@
+/*
+Teste da lista versionada (ListaVersionadaDE.h):
+  - sequências aleatórias de push/pushFirst/insertAt, popAt, popByValue,
+    move, set, clear e deslocate (na mesma lista e entre duas listas)
+    comparadas com um modelo (vector). Índices inválidos lançam
+    out_of_range sem publicar versão;
+  - isolamento dos snapshots: cada snapshot guardado continua igual ao
+    modelo do momento em que foi obtido depois de todas as alterações
+    seguintes, e o número de versão cresce a cada alteração;
+  - leitores concorrentes: enquanto o escritor altera a lista, cada
+    leitor obtém snapshots e confere que cada um é uma versão completa
+    (os valores são sempre uma permutação de 0..n-1) e que um snapshot
+    antigo não muda.
+Uso: ./teste_versionada [leitores] [operações do escritor]
+*/
+
+#include "../ListaVersionadaDE.h"
+#include "Verificacao.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+typedef VersionedDoublyLinkedList<string> Lista;
+typedef vector<string> Modelo;
+
+template <typename L>
+Modelo valores(const L& lista) {
+    return Modelo(lista.begin(), lista.end());
+}
+
+static void verificar(const Lista& lista, const Modelo& modelo) {
+    VERIFICA(lista.length() == static_cast<int>(modelo.size()));
+    VERIFICA(valores(lista) == modelo);
+    ListSnapshot<string> s = lista.snapshot();
+    VERIFICA(s.version() == lista.version());
+    VERIFICA(valores(s) == modelo);
+    for (int i = 0; i < s.length(); i++)
+        VERIFICA(s[i] == modelo[i] && lista.get(i) == modelo[i]);
+}
+
+static void sequenciaAleatoria(unsigned semente) {
+    mt19937 rng(semente);
+    Lista a, b;
+    Modelo ma, mb;
+    vector<pair<ListSnapshot<string>, Modelo> > guardados;
+    for (int passo = 0; passo < 3000; passo++) {
+        int na = a.length();
+        unsigned long long versao = a.version();
+        bool altera = true;
+        string valor = to_string(rng() % 30) + string(20, '#');
+        switch (rng() % 9) {
+        case 0:
+            a.push(valor);
+            ma.push_back(valor);
+            break;
+        case 1:
+            a.pushFirst(valor);
+            ma.insert(ma.begin(), valor);
+            break;
+        case 2: {
+            int pos = static_cast<int>(rng() % (na + 1));
+            VERIFICA_EXCECAO(a.insertAt(na + 1, valor), out_of_range);
+            a.insertAt(pos, valor);
+            ma.insert(ma.begin() + pos, valor);
+            break;
+        }
+        case 3: {
+            VERIFICA_EXCECAO(a.popAt(na), out_of_range);
+            if (na == 0) {
+                altera = false;
+                break;
+            }
+            int indice = static_cast<int>(rng() % na);
+            VERIFICA(a.popAt(indice) == ma[indice]);
+            ma.erase(ma.begin() + indice);
+            break;
+        }
+        case 4: {
+            Modelo::iterator it = find(ma.begin(), ma.end(), valor);
+            if (it == ma.end()) {
+                VERIFICA_EXCECAO(a.popByValue(valor), runtime_error);
+                altera = false;
+                break;
+            }
+            a.popByValue(valor);
+            ma.erase(it);
+            break;
+        }
+        case 5: {
+            VERIFICA_EXCECAO(a.move(0, na), out_of_range);
+            VERIFICA_EXCECAO(a.move(na, 0), out_of_range);
+            if (na == 0) {
+                altera = false;
+                break;
+            }
+            int indice = static_cast<int>(rng() % na);
+            int novo = static_cast<int>(rng() % na);
+            a.move(indice, novo);
+            altera = indice != novo;
+            string movido = ma[indice];
+            ma.erase(ma.begin() + indice);
+            ma.insert(ma.begin() + (indice < novo ? novo - 1 : novo), movido);
+            break;
+        }
+        case 6: {
+            VERIFICA_EXCECAO(a.set(na, valor), out_of_range);
+            if (na == 0) {
+                altera = false;
+                break;
+            }
+            int indice = static_cast<int>(rng() % na);
+            a.set(indice, valor);
+            ma[indice] = valor;
+            break;
+        }
+        case 7: {
+            // Entre listas, nos dois sentidos
+            int nb = b.length();
+            VERIFICA_EXCECAO(deslocate(a, b, 0, nb + 1), out_of_range);
+            VERIFICA_EXCECAO(deslocate(b, a, nb, 0), out_of_range);
+            if (na == 0) {
+                altera = false;
+                break;
+            }
+            int indice = static_cast<int>(rng() % na);
+            int novo = static_cast<int>(rng() % (nb + 1));
+            deslocate(a, b, indice, novo);
+            mb.insert(mb.begin() + novo, ma[indice]);
+            ma.erase(ma.begin() + indice);
+            if (rng() % 2 && !mb.empty()) {
+                indice = static_cast<int>(rng() % mb.size());
+                novo = static_cast<int>(rng() % (ma.size() + 1));
+                deslocate(b, a, indice, novo);
+                ma.insert(ma.begin() + novo, mb[indice]);
+                mb.erase(mb.begin() + indice);
+            }
+            break;
+        }
+        case 8: {
+            // Na mesma lista: newIndex contado depois da retirada
+            VERIFICA_EXCECAO(deslocate(a, a, 0, na), out_of_range);
+            if (na == 0) {
+                altera = false;
+                break;
+            }
+            int indice = static_cast<int>(rng() % na);
+            int novo = static_cast<int>(rng() % na);
+            deslocate(a, a, indice, novo);
+            string movido = ma[indice];
+            ma.erase(ma.begin() + indice);
+            ma.insert(ma.begin() + novo, movido);
+            break;
+        }
+        }
+        if (rng() % 200 == 0) {
+            a.clear();
+            ma.clear();
+            altera = na > 0 || altera;
+        }
+        VERIFICA(altera ? a.version() > versao : a.version() == versao);
+        verificar(a, ma);
+        verificar(b, mb);
+        if (rng() % 20 == 0)
+            guardados.push_back(make_pair(a.snapshot(), ma));
+    }
+    // Nenhuma alteração posterior aparece nos snapshots guardados
+    unsigned long long anterior = 0;
+    for (size_t i = 0; i < guardados.size(); i++) {
+        VERIFICA(valores(guardados[i].first) == guardados[i].second);
+        VERIFICA(guardados[i].first.length() == static_cast<int>(guardados[i].second.size()));
+        VERIFICA(guardados[i].first.version() >= anterior);
+        anterior = guardados[i].first.version();
+    }
+}
+
+// Confere que o snapshot é uma permutação de 0..n-1 e retorna os valores
+// em ordem.
+static vector<int> conferirPermutacao(const ListSnapshot<int>& s) {
+    vector<int> resultado(s.begin(), s.end());
+    VERIFICA(static_cast<int>(resultado.size()) == s.length());
+    vector<int> ordenado(resultado);
+    sort(ordenado.begin(), ordenado.end());
+    for (size_t i = 0; i < ordenado.size(); i++)
+        VERIFICA(ordenado[i] == static_cast<int>(i));
+    return resultado;
+}
+
+static void leitoresConcorrentes(int leitores, int operacoes) {
+    VersionedDoublyLinkedList<int> lista;
+    for (int i = 0; i < 64; i++)
+        lista.push(i);
+    atomic<bool> fim(false);
+    atomic<long long> conferidos(0);
+
+    vector<thread> threads;
+    for (int t = 0; t < leitores; t++) {
+        threads.push_back(thread([&lista, &fim, &conferidos]() {
+            unsigned long long ultimaVersao = 0;
+            ListSnapshot<int> antigo = lista.snapshot();
+            vector<int> valoresAntigos = conferirPermutacao(antigo);
+            long long n = 0;
+            while (!fim.load()) {
+                ListSnapshot<int> s = lista.snapshot();
+                VERIFICA(s.version() >= ultimaVersao);
+                ultimaVersao = s.version();
+                vector<int> atuais = conferirPermutacao(s);
+                for (int i = 0; i < s.length(); i += 7)
+                    VERIFICA(s[i] == atuais[i]);
+                if (++n % 16 == 0) {
+                    VERIFICA(vector<int>(antigo.begin(), antigo.end()) == valoresAntigos);
+                    antigo = s;
+                    valoresAntigos.swap(atuais);
+                }
+            }
+            conferidos += n;
+        }));
+    }
+
+    // Escritor: cada versão publicada é uma permutação de 0..n-1
+    mt19937 rng(11);
+    VersionedDoublyLinkedList<int> auxiliar;
+    for (int op = 0; op < operacoes; op++) {
+        int n = lista.length();
+        switch (rng() % 5) {
+        case 0:
+            lista.insertAt(static_cast<int>(rng() % (n + 1)), n);
+            break;
+        case 1:
+            if (n > 1)
+                lista.popByValue(n - 1);
+            break;
+        case 2:
+            lista.move(static_cast<int>(rng() % n), static_cast<int>(rng() % n));
+            break;
+        case 3: {
+            int i = static_cast<int>(rng() % n);
+            lista.set(i, lista.get(i));
+            break;
+        }
+        case 4:
+            deslocate(lista, lista, static_cast<int>(rng() % n), static_cast<int>(rng() % n));
+            break;
+        }
+    }
+    fim = true;
+    for (size_t t = 0; t < threads.size(); t++)
+        threads[t].join();
+    conferirPermutacao(lista.snapshot());
+    VERIFICA(leitores == 0 || conferidos.load() > 0);
+}
+
+int main(int argc, char* argv[]) {
+    int leitores = argc > 1 ? atoi(argv[1]) : 4;
+    int operacoes = argc > 2 ? atoi(argv[2]) : 20000;
+    for (unsigned semente = 1; semente <= 5; semente++)
+        sequenciaAleatoria(semente);
+    leitoresConcorrentes(leitores, operacoes);
+    printf("VersionedDoublyLinkedList: ok\n");
+    return 0;
+}
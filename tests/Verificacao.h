@@ -0,0 +1,38 @@
+#ifndef VERIFICACAO_H
+#define VERIFICACAO_H
+
+/*
+Descrição:
+Macros de verificação dos testes da pasta tests/. Diferente de assert,
+continuam ativas em builds Release (NDEBUG): uma falha imprime o
+arquivo, a linha e a condição e encerra o teste com código 1, que o
+CTest registra como falha.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+
+#define VERIFICA(condicao)                                                              \
+    do {                                                                                \
+        if (!(condicao)) {                                                              \
+            fprintf(stderr, "%s:%d: falha na verificação: %s\n", __FILE__, __LINE__, #condicao); \
+            exit(1);                                                                    \
+        }                                                                               \
+    } while (0)
+
+// Verifica que 'expressao' lança uma exceção do tipo 'Excecao'.
+#define VERIFICA_EXCECAO(expressao, Excecao)                                            \
+    do {                                                                                \
+        bool lancou = false;                                                            \
+        try {                                                                           \
+            expressao;                                                                  \
+        } catch (const Excecao&) {                                                      \
+            lancou = true;                                                              \
+        }                                                                               \
+        if (!lancou) {                                                                  \
+            fprintf(stderr, "%s:%d: %s não lançou %s\n", __FILE__, __LINE__, #expressao, #Excecao); \
+            exit(1);                                                                    \
+        }                                                                               \
+    } while (0)
+
+#endif // VERIFICACAO_H